@@ -0,0 +1,934 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			ansirenderer.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "ansirenderer.h"
+
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include <iostream>
+using std::cout;
+using std::flush;
+
+//Need to turn on escape sequences in the Windows console, to write a
+//frame straight to the output w/o stdio, and to find the screen size
+#ifdef _WIN32
+#include <Windows.h>
+#include <io.h>
+#ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
+#define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
+#endif
+#define WRITE_OUTPUT(fd, data, length) _write(fd, data, static_cast<unsigned int>(length))
+#else
+#include <sys/ioctl.h>
+#include <unistd.h>
+#define WRITE_OUTPUT(fd, data, length) write(fd, data, static_cast<size_t>(length))
+#endif
+
+//File descriptor of standard output
+const int STDOUT_FD = 1;
+
+//Colour in effect when no cell colour is
+const int NO_COLOUR = -1;
+
+//Screen lines above the board (column ruler), & between the board
+//and the text below it
+const int RULER_LINES = 2;
+const int STATUS_LINES = 2;
+
+//Columns between column labels on the ruler
+const int RULER_LABEL_SPACING = 10;
+
+//Most bytes one cell, one row's end, and the status lines compose to
+const int MAX_CELL_BYTES = 10;
+const int MAX_ROW_END_BYTES = 5;
+const int MAX_STATUS_BYTES = 128;
+
+//Capacity of the first frame buffer a renderer allocates
+const int FRAME_INITIAL_CAPACITY = 4096;
+
+//ANSI foreground colour of each cell code
+constexpr int CELL_COLOURS[NUM_CELL_CODES] =
+{
+	30,		//No adjacent mines
+	32,		//1 adjacent mine
+	93,		//2 adjacent mines
+	91,		//3 adjacent mines
+	36,		//4 adjacent mines
+	35,		//5 adjacent mines
+	94,		//6 adjacent mines
+	34,		//7 adjacent mines
+	96,		//8 adjacent mines
+	97,		//Mine
+	95,		//Flag
+	90		//"Empty" covered spot
+};
+
+/**********************************************************************
+* Purpose:
+*	To construct an AnsiRenderer w/no frame drawn yet and no limit on
+*	how much of a board it shows.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The next Draw() repaints the whole screen. On Windows the console
+*	is set to interpret ANSI escape sequences.
+**********************************************************************/
+AnsiRenderer::AnsiRenderer() : m_row(0), m_col(0), m_viewRows(0), m_viewCols(0),
+m_frameTop(0), m_frameLeft(0), m_moveNumber(0), m_valid(false), m_viewLines(0),
+m_viewWidth(0), m_top(0), m_left(0), m_frameLength(0), m_colour(NO_COLOUR),
+m_cursorRow(-1), m_cursorCol(-1)
+{
+#ifdef _WIN32
+	HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+	DWORD mode = 0;
+
+	if (GetConsoleMode(output, &mode))
+		SetConsoleMode(output, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+#endif
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct an AnsiRenderer w/the frame & view of an existing
+*	one.
+*
+* Precondition:
+*	An existing AnsiRenderer object passed by const ref.
+*
+* Postcondition:
+*	The last frame & view are copies of the existing AnsiRenderer's.
+*	The frame buffer is not copied, as it is empty between draws.
+**********************************************************************/
+AnsiRenderer::AnsiRenderer(const AnsiRenderer & copy) : m_lastFrame(copy.m_lastFrame),
+m_row(copy.m_row), m_col(copy.m_col), m_viewRows(copy.m_viewRows),
+m_viewCols(copy.m_viewCols), m_frameTop(copy.m_frameTop), m_frameLeft(copy.m_frameLeft),
+m_moveNumber(copy.m_moveNumber), m_valid(copy.m_valid), m_viewLines(copy.m_viewLines),
+m_viewWidth(copy.m_viewWidth), m_top(copy.m_top), m_left(copy.m_left),
+m_frameLength(0), m_colour(NO_COLOUR), m_cursorRow(-1), m_cursorCol(-1)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct an AnsiRenderer by taking over the frame of an
+*	expiring AnsiRenderer instead of copying it.
+*
+* Precondition:
+*	An expiring AnsiRenderer object passed by rvalue ref.
+*
+* Postcondition:
+*	The data members hold the data of the expiring AnsiRenderer, which
+*	is left w/no frame or frame buffer.
+**********************************************************************/
+AnsiRenderer::AnsiRenderer(AnsiRenderer && move) noexcept :
+m_lastFrame(std::move(move.m_lastFrame)), m_row(move.m_row), m_col(move.m_col),
+m_viewRows(move.m_viewRows), m_viewCols(move.m_viewCols), m_frameTop(move.m_frameTop),
+m_frameLeft(move.m_frameLeft), m_moveNumber(move.m_moveNumber), m_valid(move.m_valid),
+m_viewLines(move.m_viewLines), m_viewWidth(move.m_viewWidth), m_top(move.m_top),
+m_left(move.m_left), m_frame(std::move(move.m_frame)), m_frameLength(0),
+m_colour(NO_COLOUR), m_cursorRow(-1), m_cursorCol(-1)
+{
+	//Leave expiring AnsiRenderer w/no frame
+	move.m_row = 0;
+	move.m_col = 0;
+	move.m_viewRows = 0;
+	move.m_viewCols = 0;
+	move.m_moveNumber = 0;
+	move.m_valid = false;
+}
+
+/**********************************************************************
+* Purpose:
+*	To reset the data members to default values, and destroy the
+*	AnsiRenderer.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are reset to default values.
+**********************************************************************/
+AnsiRenderer::~AnsiRenderer()
+{
+	m_row = 0;
+	m_col = 0;
+	m_viewRows = 0;
+	m_viewCols = 0;
+	m_moveNumber = 0;
+	m_valid = false;
+	m_frameLength = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To assign one existing AnsiRenderer to another by copying its
+*	frame & view.
+*
+* Precondition:
+*	An existing AnsiRenderer object passed by const ref.
+*
+* Postcondition:
+*	The last frame & view are copies of the rhs AnsiRenderer's; the
+*	frame buffer keeps its own storage.
+**********************************************************************/
+AnsiRenderer & AnsiRenderer::operator=(const AnsiRenderer & rhs)
+{
+	if (this != &rhs)
+	{
+		m_lastFrame = rhs.m_lastFrame;
+		m_row = rhs.m_row;
+		m_col = rhs.m_col;
+		m_viewRows = rhs.m_viewRows;
+		m_viewCols = rhs.m_viewCols;
+		m_frameTop = rhs.m_frameTop;
+		m_frameLeft = rhs.m_frameLeft;
+		m_moveNumber = rhs.m_moveNumber;
+		m_valid = rhs.m_valid;
+		m_viewLines = rhs.m_viewLines;
+		m_viewWidth = rhs.m_viewWidth;
+		m_top = rhs.m_top;
+		m_left = rhs.m_left;
+	}
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To assign an expiring AnsiRenderer to an existing one by taking
+*	over its frame instead of copying it.
+*
+* Precondition:
+*	An expiring AnsiRenderer object passed by rvalue ref.
+*
+* Postcondition:
+*	The existing AnsiRenderer holds the data of the expiring one,
+*	which is left holding the old data until it is destroyed.
+**********************************************************************/
+AnsiRenderer & AnsiRenderer::operator=(AnsiRenderer && rhs) noexcept
+{
+	swap(rhs);
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To exchange the data of two AnsiRenderers without copying it.
+*
+* Precondition:
+*	An existing AnsiRenderer object passed by ref.
+*
+* Postcondition:
+*	Each AnsiRenderer holds the data the other held before.
+**********************************************************************/
+void AnsiRenderer::swap(AnsiRenderer & other) noexcept
+{
+	m_lastFrame.swap(other.m_lastFrame);
+	std::swap(m_row, other.m_row);
+	std::swap(m_col, other.m_col);
+	std::swap(m_viewRows, other.m_viewRows);
+	std::swap(m_viewCols, other.m_viewCols);
+	std::swap(m_frameTop, other.m_frameTop);
+	std::swap(m_frameLeft, other.m_frameLeft);
+	std::swap(m_moveNumber, other.m_moveNumber);
+	std::swap(m_valid, other.m_valid);
+	std::swap(m_viewLines, other.m_viewLines);
+	std::swap(m_viewWidth, other.m_viewWidth);
+	std::swap(m_top, other.m_top);
+	std::swap(m_left, other.m_left);
+	m_frame.swap(other.m_frame);
+	std::swap(m_frameLength, other.m_frameLength);
+	std::swap(m_colour, other.m_colour);
+	std::swap(m_cursorRow, other.m_cursorRow);
+	std::swap(m_cursorCol, other.m_cursorCol);
+}
+
+/**********************************************************************
+* Purpose:
+*	To bring the screen up to date w/the view of the board. If the
+*	latest move is outside the view, the view first scrolls to centre
+*	it. The view & rulers are only repainted in full the first time or
+*	when the board's or view's size changes. After a scroll every cell
+*	in view is compared w/the last frame; if the board made exactly
+*	one move, only the cells in that move's delta stream are checked.
+*	Either way, only cells that look different are composed into the
+*	frame buffer, which then goes to the terminal in a single write,
+*	so the cost follows the size of the view, not of the board.
+*
+* Precondition:
+*	A Board passed by const ref.
+*
+* Postcondition:
+*	The screen shows the view of the board, its rulers, and its status
+*	line, everything below is cleared, and the cursor waits on the
+*	first line below.
+**********************************************************************/
+void AnsiRenderer::Draw(const Board & board)
+{
+	int numRows = board.GetRow();
+	int numColumns = board.GetColumn();
+	int viewRows = numRows;
+	int viewCols = numColumns;
+	int rulerWidth = CountDigits(numRows - 1);
+
+	//Fit the view in the screen area, keeping at least one cell
+	if (m_viewLines > 0 && viewRows > m_viewLines - RULER_LINES)
+		viewRows = (m_viewLines - RULER_LINES > 1) ? m_viewLines - RULER_LINES : 1;
+
+	if (m_viewWidth > 0 && viewCols > (m_viewWidth - rulerWidth - 1) / 2)
+		viewCols = ((m_viewWidth - rulerWidth - 1) / 2 > 1) ? (m_viewWidth - rulerWidth - 1) / 2 : 1;
+
+	//If a move was made out of view, centre the view on it
+	if (board.GetMoveNumber() != m_moveNumber && board.GetMoveNumber() > 0)
+	{
+		CellCoord last = board.GetLastMove();
+
+		if (last.row < m_top || last.row >= m_top + viewRows)
+			m_top = last.row - viewRows / 2;
+
+		if (last.column < m_left || last.column >= m_left + viewCols)
+			m_left = last.column - viewCols / 2;
+	}
+
+	//Keep the view on the board
+	if (m_top > numRows - viewRows)
+		m_top = numRows - viewRows;
+	if (m_top < 0)
+		m_top = 0;
+	if (m_left > numColumns - viewCols)
+		m_left = numColumns - viewCols;
+	if (m_left < 0)
+		m_left = 0;
+
+	//If nothing usable is on screen, repaint it all
+	if (!m_valid || numRows != m_row || numColumns != m_col ||
+		viewRows != m_viewRows || viewCols != m_viewCols)
+	{
+		m_row = numRows;
+		m_col = numColumns;
+		m_viewRows = viewRows;
+		m_viewCols = viewCols;
+		m_lastFrame.Resize(viewRows * viewCols);
+
+		//Room for the whole frame up front, so the loop never grows it
+		Reserve((viewRows + RULER_LINES) * (viewCols * MAX_CELL_BYTES + rulerWidth +
+			MAX_ROW_END_BYTES) + MAX_STATUS_BYTES);
+
+		//Reset scroll region & clear screen
+		Append("\x1b[r\x1b[2J\x1b[H", 10);
+		m_cursorRow = 0;
+		m_cursorCol = 0;
+
+		WriteColumnRuler();
+
+		for (int i = 0; i < viewRows; i++)
+		{
+			MoveToScreen(RULER_LINES + i, 0);
+			WriteRowLabel(m_top + i);
+
+			for (int j = 0; j < viewCols; j++)
+			{
+				int code = GetCellCode(board.GetCellState(m_top + i, m_left + j),
+					board.GetCellValue(m_top + i, m_left + j));
+
+				m_lastFrame(i * viewCols + j) = static_cast<uint8_t>(code);
+				WriteCell(code);
+			}
+
+			//Default colours before the newline, so a scroll never
+			//paints the new line grey
+			ResetColour();
+			Append("\n", 1);
+			m_cursorRow++;
+			m_cursorCol = 0;
+		}
+
+		//Prompts scroll below the board, never over it
+		Append("\x1b[", 2);
+		AppendNumber(RULER_LINES + viewRows + STATUS_LINES + 1);
+		Append("r", 1);
+		m_cursorRow = -1;
+	}
+	//Else if the view scrolled, relabel it and compare every cell in it
+	else if (m_top != m_frameTop || m_left != m_frameLeft)
+	{
+		if (m_left != m_frameLeft)
+			WriteColumnRuler();
+
+		if (m_top != m_frameTop)
+		{
+			for (int i = 0; i < viewRows; i++)
+			{
+				MoveToScreen(RULER_LINES + i, 0);
+				WriteRowLabel(m_top + i);
+			}
+		}
+
+		CompareView(board);
+	}
+	//Else if one move was made, only its deltas can differ (a legal
+	//move always changes a cell, so no deltas means an illegal move
+	//came after it and they were lost)
+	else if (board.GetMoveNumber() == m_moveNumber + 1 && board.GetDeltaCount() > 0)
+	{
+		const CellDelta * deltas = board.GetDeltas();
+
+		for (int k = 0; k < board.GetDeltaCount(); k++)
+		{
+			int i = deltas[k].row - m_top;
+			int j = deltas[k].column - m_left;
+
+			//If cell is in view
+			if (i >= 0 && i < viewRows && j >= 0 && j < viewCols)
+			{
+				int code = GetCellCode(deltas[k].state,
+					board.GetCellValue(deltas[k].row, deltas[k].column));
+
+				if (m_lastFrame(i * viewCols + j) != code)
+				{
+					m_lastFrame(i * viewCols + j) = static_cast<uint8_t>(code);
+					MoveCursor(i, j);
+					WriteCell(code);
+				}
+			}
+		}
+	}
+	//Else if moves were missed (or the board was recreated), compare all
+	else if (board.GetMoveNumber() != m_moveNumber)
+	{
+		CompareView(board);
+	}
+
+	m_frameTop = m_top;
+	m_frameLeft = m_left;
+	m_moveNumber = board.GetMoveNumber();
+	m_valid = true;
+
+	//Rewrite status line, then clear the text area below it
+	ResetColour();
+	MoveToScreen(RULER_LINES + viewRows + 1, 0);
+	Append("\x1b[2KMines remaining: ", 21);
+	AppendNumber(board.GetMinesRemaining());
+	Append("   Cells left: ", 15);
+	AppendNumber(board.GetCellsLeft());
+
+	//If only part of the board fits, say which part
+	if (viewRows < numRows || viewCols < numColumns)
+	{
+		Append("   Rows ", 8);
+		AppendNumber(m_top);
+		Append("-", 1);
+		AppendNumber(m_top + viewRows - 1);
+		Append(" of ", 4);
+		AppendNumber(numRows);
+		Append(", columns ", 10);
+		AppendNumber(m_left);
+		Append("-", 1);
+		AppendNumber(m_left + viewCols - 1);
+		Append(" of ", 4);
+		AppendNumber(numColumns);
+	}
+
+	MoveToScreen(RULER_LINES + viewRows + STATUS_LINES, 0);
+	Append("\x1b[J", 3);
+
+	Flush();
+}
+
+/**********************************************************************
+* Purpose:
+*	To make the next Draw() repaint the whole screen, e.g. after other
+*	output has covered the board.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The last frame is marked as no longer on screen.
+**********************************************************************/
+void AnsiRenderer::Invalidate()
+{
+	m_valid = false;
+}
+
+/**********************************************************************
+* Purpose:
+*	To limit the view of the board, rulers included, to a screen area
+*	so boards larger than it are shown a window at a time.
+*
+* Precondition:
+*	Two integers specifying the # lines and character columns the
+*	view may use (zero or less for no limit).
+*
+* Postcondition:
+*	The next Draw() shows as much of the board as fits.
+**********************************************************************/
+void AnsiRenderer::SetViewport(int lines, int columns)
+{
+	m_viewLines = (lines > 0) ? lines : 0;
+	m_viewWidth = (columns > 0) ? columns : 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To limit the view of the board to the terminal window, leaving
+*	lines below it for the status line and the given # lines of
+*	prompts.
+*
+* Precondition:
+*	An integer specifying the # lines to leave for prompts.
+*
+* Postcondition:
+*	True is returned and the view fits the terminal if its size is
+*	known; else, false is returned and the view is left unchanged.
+**********************************************************************/
+bool AnsiRenderer::FitToTerminal(int reservedLines)
+{
+	int lines = 0;
+	int columns = 0;
+
+#ifdef _WIN32
+	CONSOLE_SCREEN_BUFFER_INFO info;
+
+	if (GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &info))
+	{
+		lines = info.srWindow.Bottom - info.srWindow.Top + 1;
+		columns = info.srWindow.Right - info.srWindow.Left + 1;
+	}
+#else
+	winsize size;
+
+	if (ioctl(STDOUT_FD, TIOCGWINSZ, &size) == 0)
+	{
+		lines = size.ws_row;
+		columns = size.ws_col;
+	}
+#endif
+
+	//If output isn't a terminal, there is no window to fit
+	if (lines <= 0 || columns <= 0)
+		return false;
+
+	//Never fill the last column, where writing would wrap the line
+	SetViewport(lines - STATUS_LINES - reservedLines, columns - 1);
+
+	return true;
+}
+
+/**********************************************************************
+* Purpose:
+*	To scroll the view so the given cell is in its top left corner, or
+*	as close as the edges of the board allow.
+*
+* Precondition:
+*	Two integers specifying a row and column pair.
+*
+* Postcondition:
+*	The next Draw() shows the view from that cell.
+**********************************************************************/
+void AnsiRenderer::ScrollTo(int row, int column)
+{
+	m_top = row;
+	m_left = column;
+}
+
+/**********************************************************************
+* Purpose:
+*	To scroll the view by a # rows and columns, as far as the edges
+*	of the board allow.
+*
+* Precondition:
+*	Two integers specifying the # rows and columns to scroll by
+*	(negative scrolls up or left).
+*
+* Postcondition:
+*	The next Draw() shows the scrolled view.
+**********************************************************************/
+void AnsiRenderer::ScrollBy(int rows, int columns)
+{
+	m_top += rows;
+	m_left += columns;
+}
+
+/**********************************************************************
+* Purpose:
+*	To clear the whole screen for output that isn't a board.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The screen is cleared w/no scroll region, the cursor is in the top
+*	left corner, and the next Draw() repaints the whole screen.
+**********************************************************************/
+void AnsiRenderer::ClearScreen()
+{
+	Append("\x1b[r\x1b[2J\x1b[H", 10);
+	Flush();
+	Invalidate();
+}
+
+/**********************************************************************
+* Purpose:
+*	To give the whole screen back to scrolling before the program
+*	exits, w/o moving the cursor.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The scroll region is reset & the colours are back to default.
+**********************************************************************/
+void AnsiRenderer::RestoreTerminal()
+{
+	//Setting the scroll region homes the cursor, so save & restore it
+	Append("\x1b" "7\x1b[r\x1b" "8\x1b[0m", 11);
+	Flush();
+	Invalidate();
+}
+
+/**********************************************************************
+* Purpose:
+*	To compare every cell in view w/the last frame, composing only
+*	the cells that look different.
+*
+* Precondition:
+*	A Board passed by const ref, the same size as the last frame.
+*
+* Postcondition:
+*	The last frame matches the view of the board.
+**********************************************************************/
+void AnsiRenderer::CompareView(const Board & board)
+{
+	for (int i = 0; i < m_viewRows; i++)
+	{
+		for (int j = 0; j < m_viewCols; j++)
+		{
+			int code = GetCellCode(board.GetCellState(m_top + i, m_left + j),
+				board.GetCellValue(m_top + i, m_left + j));
+
+			if (m_lastFrame(i * m_viewCols + j) != code)
+			{
+				m_lastFrame(i * m_viewCols + j) = static_cast<uint8_t>(code);
+				MoveCursor(i, j);
+				WriteCell(code);
+			}
+		}
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To compose the column ruler above the view: the full # of every
+*	tenth column on the first line, and the last digit of every
+*	column on the second.
+*
+* Precondition:
+*	The colours are the defaults.
+*
+* Postcondition:
+*	Both ruler lines are rewritten.
+**********************************************************************/
+void AnsiRenderer::WriteColumnRuler()
+{
+	int rulerWidth = CountDigits(m_row - 1);
+	int used = 0;	//Chars on the line so far
+
+	//Labels line
+	MoveToScreen(0, 0);
+	Append("\x1b[2K", 4);
+
+	for (int j = 0; j < m_viewCols; j++)
+	{
+		int column = m_left + j;
+
+		if (column % RULER_LABEL_SPACING == 0)
+		{
+			int x = rulerWidth + 1 + j * 2;
+			int digits = CountDigits(column);
+
+			//Only if the label ends w/in the view
+			if (digits <= (m_viewCols - j) * 2)
+			{
+				Reserve(x - used);
+				memset(&m_frame(m_frameLength), ' ', x - used);
+				m_frameLength += x - used;
+				AppendNumber(column);
+				used = x + digits;
+			}
+		}
+	}
+
+	//Digits line
+	MoveToScreen(1, 0);
+	Append("\x1b[2K", 4);
+	Reserve(rulerWidth + 1 + m_viewCols * 2);
+
+	char * out = &m_frame(m_frameLength);
+
+	memset(out, ' ', rulerWidth + 1);
+	out += rulerWidth + 1;
+
+	for (int j = 0; j < m_viewCols; j++)
+	{
+		out[0] = static_cast<char>('0' + (m_left + j) % 10);
+		out[1] = ' ';
+		out += 2;
+	}
+
+	m_frameLength = static_cast<int>(out - &m_frame(0));
+	m_cursorRow = -1;
+}
+
+/**********************************************************************
+* Purpose:
+*	To compose a row's label at the start of its line, right aligned
+*	in the row ruler.
+*
+* Precondition:
+*	An integer specifying the row #. The cursor is at the start of
+*	the row's line and the colours are the defaults.
+*
+* Postcondition:
+*	The label and a spacer are composed, and the cursor is at the
+*	row's first cell.
+**********************************************************************/
+void AnsiRenderer::WriteRowLabel(int row)
+{
+	int rulerWidth = CountDigits(m_row - 1);
+	int padding = rulerWidth - CountDigits(row);
+
+	Reserve(padding);
+	memset(&m_frame(m_frameLength), ' ', padding);
+	m_frameLength += padding;
+	AppendNumber(row);
+	Append(" ", 1);
+
+	m_cursorCol = rulerWidth + 1;
+}
+
+/**********************************************************************
+* Purpose:
+*	To compose one cell at the cursor: its colour on the board's light
+*	grey background (only if the cell before it was a different
+*	colour), its glyph, and a spacer.
+*
+* Precondition:
+*	A cell code from GetCellCode().
+*
+* Postcondition:
+*	The cell is in the frame buffer and the cursor is past its spacer.
+**********************************************************************/
+void AnsiRenderer::WriteCell(int code)
+{
+	int colour = CELL_COLOURS[code];
+
+	Reserve(MAX_CELL_BYTES);
+
+	char * out = &m_frame(m_frameLength);
+
+	//Switch colours only between runs of differently coloured cells
+	if (colour != m_colour)
+	{
+		memcpy(out, "\x1b[47;", 5);
+		out[5] = static_cast<char>('0' + colour / 10);
+		out[6] = static_cast<char>('0' + colour % 10);
+		out[7] = 'm';
+		out += 8;
+		m_colour = colour;
+	}
+
+	out[0] = CELL_GLYPHS[code];
+	out[1] = ' ';
+	out += 2;
+
+	m_frameLength = static_cast<int>(out - &m_frame(0));
+	m_cursorCol += 2;
+}
+
+/**********************************************************************
+* Purpose:
+*	To move the cursor to a cell in view.
+*
+* Precondition:
+*	Two integers specifying a row and column pair in the view,
+*	counted from its top left cell.
+*
+* Postcondition:
+*	The cursor is at the start of the cell.
+**********************************************************************/
+void AnsiRenderer::MoveCursor(int row, int column)
+{
+	//Each cell is 2 chars wide, right of the row ruler & its spacer
+	MoveToScreen(RULER_LINES + row, CountDigits(m_row - 1) + 1 + column * 2);
+}
+
+/**********************************************************************
+* Purpose:
+*	To move the cursor to a screen position, unless it is already
+*	there (e.g. the cell right after the last one written).
+*
+* Precondition:
+*	Two integers specifying a line and character column, counted from
+*	zero.
+*
+* Postcondition:
+*	The cursor is at the position.
+**********************************************************************/
+void AnsiRenderer::MoveToScreen(int line, int column)
+{
+	if (line != m_cursorRow || column != m_cursorCol)
+	{
+		//Screen positions count from one
+		Append("\x1b[", 2);
+		AppendNumber(line + 1);
+		Append(";", 1);
+		AppendNumber(column + 1);
+		Append("H", 1);
+
+		m_cursorRow = line;
+		m_cursorCol = column;
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the terminal to its default colours, if a cell colour is
+*	in effect.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The next cell composed starts w/a colour escape.
+**********************************************************************/
+void AnsiRenderer::ResetColour()
+{
+	if (m_colour != NO_COLOUR)
+	{
+		Append("\x1b[0m", 4);
+		m_colour = NO_COLOUR;
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To make sure the frame buffer has room for more bytes, doubling
+*	it when it is full so it stops growing once it fits the largest
+*	frame drawn.
+*
+* Precondition:
+*	The # bytes about to be composed.
+*
+* Postcondition:
+*	The frame buffer can hold that many more bytes.
+**********************************************************************/
+void AnsiRenderer::Reserve(int bytes)
+{
+	int needed = m_frameLength + bytes;
+
+	if (needed > m_frame.getLength())
+	{
+		int length = (m_frame.getLength() > 0) ? m_frame.getLength() * 2 : FRAME_INITIAL_CAPACITY;
+
+		if (length < needed)
+			length = needed;
+
+		//Keep what is already composed
+		m_frame.setLength(length);
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To add bytes to the end of the frame buffer.
+*
+* Precondition:
+*	A pointer to the bytes and how many there are.
+*
+* Postcondition:
+*	The bytes are in the frame buffer.
+**********************************************************************/
+void AnsiRenderer::Append(const char * text, int length)
+{
+	Reserve(length);
+	memcpy(&m_frame(m_frameLength), text, length);
+	m_frameLength += length;
+}
+
+/**********************************************************************
+* Purpose:
+*	To add an integer to the frame buffer as decimal text.
+*
+* Precondition:
+*	The integer to add.
+*
+* Postcondition:
+*	The integer's digits (and sign) are in the frame buffer.
+**********************************************************************/
+void AnsiRenderer::AppendNumber(int number)
+{
+	char digits[12];		//Enough for any int & its sign
+
+	Append(digits, WriteNumber(digits, number));
+}
+
+/**********************************************************************
+* Purpose:
+*	To send the composed frame to the terminal in one write, after
+*	anything still buffered in cout so the output stays in order.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The frame buffer is written and emptied (its storage is kept).
+**********************************************************************/
+void AnsiRenderer::Flush()
+{
+	cout << flush;
+	fflush(stdout);
+
+	const char * data = &m_frame(0);
+	int remaining = m_frameLength;
+
+	//A terminal may take less than all of it, so keep writing the rest
+	while (remaining > 0)
+	{
+		int written = static_cast<int>(WRITE_OUTPUT(STDOUT_FD, data, remaining));
+
+		//If the output is gone, drop the frame
+		if (written <= 0)
+			break;
+
+		data += written;
+		remaining -= written;
+	}
+
+	m_frameLength = 0;
+	m_cursorRow = -1;
+}
+
+/**********************************************************************
+* Purpose:
+*	To let generic code (and std::swap callers using ADL) exchange two
+*	AnsiRenderers without copying them.
+*
+* Precondition:
+*	Two existing AnsiRenderer objects passed by ref.
+*
+* Postcondition:
+*	Each AnsiRenderer holds the data the other held before.
+**********************************************************************/
+void swap(AnsiRenderer & lhs, AnsiRenderer & rhs) noexcept
+{
+	lhs.swap(rhs);
+}
@@ -0,0 +1,204 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			ansirenderer.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: AnsiRenderer
+*
+* Purpose:
+*	This Renderer draws a Board on a terminal w/ANSI escape sequences,
+*	w/row & column rulers. A board too big for the screen area given
+*	to it is shown through a view that scrolls to follow the latest
+*	move, and only the cells in view are ever read or drawn.
+*	It keeps the frame it drew last, so after the first frame only the
+*	cells that changed are rewritten, each one reached by moving the
+*	cursor straight to it. The rows below the board are made a scroll
+*	region, so the prompts printed there never scroll the board away.
+*	A frame is composed into a byte buffer that is kept between
+*	frames, and a colour escape is only written where the colour
+*	changes, so even a full repaint is one write of about 2 bytes per
+*	cell.
+*
+* Manager functions:
+*	AnsiRenderer()
+*		Creates a renderer w/no frame drawn yet that shows all of a
+*		board. On Windows, turns on the console's handling of ANSI
+*		escape sequences.
+*
+*	AnsiRenderer(const AnsiRenderer & copy)
+*
+*	AnsiRenderer(AnsiRenderer && move)
+*		Takes over the frame of an expiring AnsiRenderer without
+*		copying it.
+*
+*	~AnsiRenderer()
+*
+*	AnsiRenderer & operator=(const AnsiRenderer & rhs)
+*
+*	AnsiRenderer & operator=(AnsiRenderer && rhs)
+*		Takes over the frame of an expiring AnsiRenderer without
+*		copying it.
+*
+*	void swap(AnsiRenderer & other)
+*		Exchanges the data of two AnsiRenderers without copying it.
+*
+* Methods:
+*	void Draw(const Board & board)
+*		Brings the screen up to date w/the view of the board,
+*		repainting it all only when there is no frame yet or the
+*		board or view changed size. Leaves the cursor on the line
+*		below the board's status line.
+*
+*	void Invalidate()
+*		Makes the next Draw() repaint the whole screen.
+*
+*	void SetViewport(int lines, int columns)
+*		Limits the view, rulers included, to a screen area (zero for
+*		no limit).
+*
+*	bool FitToTerminal(int reservedLines)
+*		Limits the view to the terminal window, less the status line
+*		and the given # lines of prompts. Returns false if the size
+*		of the window can't be found.
+*
+*	void ScrollTo(int row, int column)
+*	void ScrollBy(int rows, int columns)
+*		Move the view, to a top left cell or by an offset.
+*
+*	void ClearScreen()
+*		Clears the screen & scroll region and invalidates the frame.
+*
+*	void RestoreTerminal()
+*		Gives the whole screen back to scrolling, e.g. before exiting.
+*
+*	void CompareView(const Board & board)
+*		Composes every cell in view that differs from the last frame.
+*
+*	void WriteColumnRuler()
+*	void WriteRowLabel(int row)
+*		Compose the rulers.
+*
+*	void WriteCell(int code)
+*		Composes a cell's colour (if it changed), glyph, and spacer.
+*
+*	void MoveCursor(int row, int column)
+*		Composes a move of the cursor to a cell in view.
+*
+*	void MoveToScreen(int line, int column)
+*		Composes a move of the cursor to a screen position, unless it
+*		is already there.
+*
+*	void ResetColour()
+*		Composes a return to the default colours, if needed.
+*
+*	void Reserve(int bytes)
+*		Grows the frame buffer to fit more bytes.
+*
+*	void Append(const char * text, int length)
+*	void AppendNumber(int number)
+*		Composes bytes or a decimal integer.
+*
+*	void Flush()
+*		Writes the composed frame to standard output in one write.
+**********************************************************************/
+
+#ifndef ANSIRENDERER_H
+#define ANSIRENDERER_H
+
+#include "renderer.h"
+
+class AnsiRenderer : public Renderer
+{
+	public:
+		//Default Ctor
+		AnsiRenderer();
+
+		//Copy Ctor
+		AnsiRenderer(const AnsiRenderer & copy);
+
+		//Move Ctor
+		AnsiRenderer(AnsiRenderer && move) noexcept;
+
+		//Default Dtor
+		~AnsiRenderer();
+
+		//Assignment Operator
+		AnsiRenderer & operator=(const AnsiRenderer & rhs);
+
+		//Move Assignment Operator
+		AnsiRenderer & operator=(AnsiRenderer && rhs) noexcept;
+
+		//Exchange data with another AnsiRenderer
+		void swap(AnsiRenderer & other) noexcept;
+
+		//Update screen w/the board
+		void Draw(const Board & board);
+
+		//Repaint everything on next Draw
+		void Invalidate();
+
+		//Limit the view to a screen area
+		void SetViewport(int lines, int columns);
+		bool FitToTerminal(int reservedLines);
+
+		//Move the view
+		void ScrollTo(int row, int column);
+		void ScrollBy(int rows, int columns);
+
+		//Clear screen for non-board output
+		void ClearScreen();
+
+		//Undo terminal settings before exiting
+		void RestoreTerminal();
+
+	private:
+		//Compose the cells in view that changed
+		void CompareView(const Board & board);
+
+		//Compose the rulers
+		void WriteColumnRuler();
+		void WriteRowLabel(int row);
+
+		//Compose one cell at the cursor
+		void WriteCell(int code);
+
+		//Compose a cursor move to a cell in view or screen position
+		void MoveCursor(int row, int column);
+		void MoveToScreen(int line, int column);
+
+		//Compose a return to default colours
+		void ResetColour();
+
+		//Frame buffer handling
+		void Reserve(int bytes);
+		void Append(const char * text, int length);
+		void AppendNumber(int number);
+		void Flush();
+
+		Array<uint8_t> m_lastFrame;		//Cell code of each cell in view on screen
+		int m_row;		//# rows on board in last frame
+		int m_col;		//# columns on board in last frame
+		int m_viewRows;		//# rows in view in last frame
+		int m_viewCols;		//# columns in view in last frame
+		int m_frameTop;		//Board cell at top left of view in last frame
+		int m_frameLeft;
+		unsigned int m_moveNumber;	//Board's move # when last frame was drawn
+		bool m_valid;	//Whether the screen shows the last frame
+
+		int m_viewLines;	//Screen area the view may use (0 for no limit)
+		int m_viewWidth;
+		int m_top;			//Board cell at top left of view for next frame
+		int m_left;
+
+		Array<char> m_frame;	//Bytes composed for the terminal
+		int m_frameLength;		//# bytes in use
+		int m_colour;			//Foreground colour in effect, if any
+		int m_cursorRow;		//Where the cursor is (-1 if unknown)
+		int m_cursorCol;
+};
+
+//Exchange two AnsiRenderers without copying them
+void swap(AnsiRenderer & lhs, AnsiRenderer & rhs) noexcept;
+
+#endif //ANSIRENDERER_H
@@ -2,7 +2,7 @@
 * Author:			Molli Drivdahl
 * Filename:			array.h
 * Date Created:		1/4/16
-* Modifications:	1/5/16
+* Modifications:	10/17/26
 *
 * Class: Array
 *
@@ -15,20 +15,46 @@
 * 		Creates an Array with the default length zero and the default
 *		starting index zero.
 *
-*	Array(int length, int start_index = 0)
+*	Array(int length, int start_index = 0,
+*		  MemoryResource * resource = nullptr)
 *		Creates an Array of a specified length with either a given
 *		starting index value or a default starting index value of zero.
+*		Storage comes from the given resource, or the heap by default.
+*
+*	explicit Array(MemoryResource * resource)
+*		Creates an empty Array that will get its storage from the given
+*		resource.
 *
 *	Array(const Array & copy)
+*		The copy gets its storage from the heap, since the resource of
+*		the original may not outlive it.
+*
+*	Array(Array && move)
+*		Takes over the data of an expiring Array without copying it.
 *
 *	~Array()
 *
 *	Array & operator=(const Array & rhs)
+*		Keeps the resource of the lhs Array.
+*
+*	Array & operator=(Array && rhs)
+*		Takes over the data of an expiring Array without copying it.
+*
+*	void swap(Array & other)
+*		Exchanges the data of two Arrays without copying it.
 *
 * Methods:
 *	T & operator[](int index) const
+*	T & at(int index) const
 *		Overloads the [] operator in order to work with Arrays of
-*		varying starting indices.
+*		varying starting indices. Both throw an Exception if the
+*		index is out of bounds.
+*
+*	T & operator()(int index) const
+*		Same as the [] operator without the bounds checks, for loops
+*		that have already validated their indices. When
+*		ARRAY_ASSERT_BOUNDS is defined (the default in _DEBUG builds)
+*		the bounds are asserted instead.
 *
 *	int getStartIndex() const
 *		Returns value of the starting index.
@@ -41,12 +67,206 @@
 *
 *	void setLength(int length)
 *		Sets value of the length.
+*
+*	int getCapacity() const
+*		Returns the number of elements the current storage can hold.
+*
+*	void Resize(int length)
+*		Gives the Array a new length with every element reset to its
+*		default value, only allocating if the storage is too small.
+*
+*	void Reset()
+*		Gives the Array zero length but keeps its storage for reuse.
+*
+*	MemoryResource * getMemoryResource() const
+*		Returns the resource the Array gets its storage from.
 **********************************************************************/
 
 #ifndef ARRAY_H
 #define ARRAY_H
 
 #include "exception.h"
+#include "memoryresource.h"
+#include "zerodefault.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+//Unchecked accessors assert their bounds in debug builds
+#if defined(_DEBUG) && !defined(ARRAY_ASSERT_BOUNDS)
+#define ARRAY_ASSERT_BOUNDS
+#endif
+
+#ifdef ARRAY_ASSERT_BOUNDS
+#include <cassert>
+#define ARRAY_BOUNDS_ASSERT(condition) assert(condition)
+#else
+#define ARRAY_BOUNDS_ASSERT(condition) ((void)0)
+#endif
+
+/**********************************************************************
+* Class: ArrayStorage
+*
+* Purpose:
+*	Allocates, copies, and frees the storage of an Array, drawing it
+*	from the Array's MemoryResource. The general version constructs
+*	and destroys every element of the storage and copies element-wise.
+*	The version for trivially copyable types uses the resource's
+*	Reallocate() and memcpy instead, and AllocateZeroed()/memset for
+*	types that are IsZeroDefault, so new storage for a large Array is
+*	handed out as untouched zero pages. Growing a zero default Array
+*	copies it into fresh zeroed storage, so the grown part is never
+*	written either.
+**********************************************************************/
+template <typename T, bool Trivial = std::is_trivially_copyable<T>::value>
+struct ArrayStorage
+{
+	//Storage for length default-constructed elements
+	static T * Allocate(MemoryResource * resource, int length)
+	{
+		T * array = static_cast<T *>(resource->Allocate(Bytes(length), alignof(T)));
+		int constructed = 0;
+
+		try
+		{
+			for (; constructed < length; constructed++)
+				new (array + constructed) T();
+		}
+		catch (...)
+		{
+			Destroy(array, constructed);
+			resource->Deallocate(array, Bytes(length), alignof(T));
+			throw;
+		}
+
+		return array;
+	}
+
+	//Storage for length elements, keeping the first oldLength (or fewer)
+	static T * Reallocate(MemoryResource * resource, T * array, int capacity, int oldLength, int length)
+	{
+		T * newArray = Allocate(resource, length);
+		int smallestLength = (oldLength < length) ? oldLength : length;
+
+		Copy(newArray, array, smallestLength);
+		Free(resource, array, capacity);
+
+		return newArray;
+	}
+
+	//Give back storage that holds capacity elements
+	static void Free(MemoryResource * resource, T * array, int capacity)
+	{
+		if (array == nullptr)
+			return;
+
+		Destroy(array, capacity);
+		resource->Deallocate(array, Bytes(capacity), alignof(T));
+	}
+
+	static void Copy(T * dest, const T * source, int count)
+	{
+		for (int i = 0; i < count; i++)
+			dest[i] = source[i];
+	}
+
+	//Set count elements back to their default value
+	static void Reset(T * array, int count)
+	{
+		for (int i = 0; i < count; i++)
+			array[i] = T();
+	}
+
+private:
+	static size_t Bytes(int count)
+	{
+		return static_cast<size_t>(count) * sizeof(T);
+	}
+
+	static void Destroy(T * array, int count)
+	{
+		for (int i = 0; i < count; i++)
+			array[i].~T();
+	}
+};
+
+template <typename T>
+struct ArrayStorage<T, true>
+{
+	static T * Allocate(MemoryResource * resource, int length)
+	{
+		void * memory = IsZeroDefault<T>::value ?
+			resource->AllocateZeroed(Bytes(length), alignof(T)) :
+			resource->Allocate(Bytes(length), alignof(T));
+
+		T * array = static_cast<T *>(memory);
+		if (!IsZeroDefault<T>::value)
+			Construct(array, length);
+
+		return array;
+	}
+
+	static T * Reallocate(MemoryResource * resource, T * array, int capacity, int oldLength, int length)
+	{
+		//Fresh zeroed storage leaves the grown part as untouched pages
+		if (IsZeroDefault<T>::value && length > oldLength)
+		{
+			T * zeroed = static_cast<T *>(resource->AllocateZeroed(Bytes(length), alignof(T)));
+
+			Copy(zeroed, array, oldLength);
+			Free(resource, array, capacity);
+
+			return zeroed;
+		}
+
+		T * newArray = static_cast<T *>(resource->Reallocate(array,
+			array != nullptr ? Bytes(capacity) : 0, Bytes(length), alignof(T)));
+
+		//Elements past the old length start at their default value
+		if (length > oldLength)
+			Reset(newArray + oldLength, length - oldLength);
+
+		return newArray;
+	}
+
+	static void Free(MemoryResource * resource, T * array, int capacity)
+	{
+		if (array != nullptr)
+			resource->Deallocate(array, Bytes(capacity), alignof(T));
+	}
+
+	static void Copy(T * dest, const T * source, int count)
+	{
+		if (count > 0)
+			memcpy(static_cast<void *>(dest), source, Bytes(count));
+	}
+
+	static void Reset(T * array, int count)
+	{
+		if (count <= 0)
+			return;
+
+		if (IsZeroDefault<T>::value)
+			memset(static_cast<void *>(array), 0, Bytes(count));
+		else
+			Construct(array, count);
+	}
+
+private:
+	static size_t Bytes(int count)
+	{
+		return static_cast<size_t>(count) * sizeof(T);
+	}
+
+	static void Construct(T * array, int count)
+	{
+		for (int i = 0; i < count; i++)
+			new (array + i) T();
+	}
+};
 
 template <typename T>
 class Array
@@ -55,21 +275,37 @@ public:
 	//Default Ctor
 	Array();
 
-	//Overloaded 2-arg Ctor
-	Array(int length, int start_index = 0);
+	//Overloaded 3-arg Ctor
+	Array(int length, int start_index = 0, MemoryResource * resource = nullptr);
+
+	//Empty Array drawing storage from a resource
+	explicit Array(MemoryResource * resource);
 
 	//Copy Ctor
 	Array(const Array<T> & copy);
 
+	//Move Ctor
+	Array(Array<T> && move) noexcept;
+
 	//Default Dtor
 	~Array();
 
 	//Assignment Operator
 	Array<T> & operator=(const Array<T> & rhs);
 
+	//Move Assignment Operator
+	Array<T> & operator=(Array<T> && rhs) noexcept;
+
+	//Exchange data with another Array
+	void swap(Array<T> & other) noexcept;
+
 	//Overloaded [] Operator
 	T & operator[](int index) const;
 
+	//Checked & unchecked element access
+	T & at(int index) const;
+	T & operator()(int index) const;
+
 	//Getters for m_start_index and m_length
 	int getStartIndex() const;
 	int getLength() const;
@@ -78,10 +314,24 @@ public:
 	void setStartIndex(int start_index);
 	void setLength(int length);
 
+	//Getter for m_capacity
+	int getCapacity() const;
+
+	//Discard data & set length, reusing storage when possible
+	void Resize(int length);
+
+	//Discard data but keep storage
+	void Reset();
+
+	//Getter for m_resource
+	MemoryResource * getMemoryResource() const;
+
 private:
 	T * m_array;		//Pointer to the dynamic array of data
 	int m_length;		//Number of elements
+	int m_capacity;		//Number of elements storage can hold
 	int m_start_index;	//Starting index (base element)
+	MemoryResource * m_resource;	//Where storage comes from
 };
 
 /**********************************************************************
@@ -96,8 +346,26 @@ private:
 *	Data members are initialized to default values.
 **********************************************************************/
 template <typename T>
-Array<T>::Array() : m_array(nullptr), m_length(0),
-m_start_index(0)
+Array<T>::Array() : m_array(nullptr), m_length(0), m_capacity(0),
+m_start_index(0), m_resource(MemoryResource::GetDefault())
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct an empty Array that will get its storage from the
+*	given resource.
+*
+* Precondition:
+*	The resource to get storage from (nullptr for the heap). The
+*	resource must outlive the Array.
+*
+* Postcondition:
+*	Data members are initialized to default values.
+**********************************************************************/
+template <typename T>
+Array<T>::Array(MemoryResource * resource) : m_array(nullptr), m_length(0),
+m_capacity(0), m_start_index(0),
+m_resource(resource != nullptr ? resource : MemoryResource::GetDefault())
 {}
 
 /**********************************************************************
@@ -106,16 +374,18 @@ m_start_index(0)
 *	members to values of the parameters.
 *
 * Precondition:
-*	An integer representing the desired length of the Array and an
-*	integer representing the desired starting index of the Array.
+*	An integer representing the desired length of the Array, an
+*	integer representing the desired starting index of the Array, and
+*	the resource to get storage from (nullptr for the heap).
 *
 * Postcondition:
 *	The data members are initialized to the values of the parameters,
 *	if desired length is not negative.
 **********************************************************************/
 template <typename T>
-Array<T>::Array(int length, int start_index) : m_array(nullptr),
-m_length(length), m_start_index(start_index)
+Array<T>::Array(int length, int start_index, MemoryResource * resource) :
+m_array(nullptr), m_length(length), m_capacity(0), m_start_index(start_index),
+m_resource(resource != nullptr ? resource : MemoryResource::GetDefault())
 {
 	//If length is negative
 	if (m_length < 0)
@@ -132,7 +402,8 @@ m_length(length), m_start_index(start_index)
 	//Else array is given desired length
 	else
 	{
-		m_array = new T[m_length];
+		m_array = ArrayStorage<T>::Allocate(m_resource, m_length);
+		m_capacity = m_length;
 	}
 }
 
@@ -152,7 +423,8 @@ m_length(length), m_start_index(start_index)
 **********************************************************************/
 template <typename T>
 Array<T>::Array(const Array<T> & copy) : m_array(nullptr),
-m_length(copy.m_length), m_start_index(copy.m_start_index)
+m_length(copy.m_length), m_capacity(0), m_start_index(copy.m_start_index),
+m_resource(MemoryResource::GetDefault())
 {
 	//If length is negative
 	if (m_length < 0)
@@ -165,6 +437,30 @@ m_length(copy.m_length), m_start_index(copy.m_start_index)
 		*this = copy;	//Use assignment operator
 }
 
+/**********************************************************************
+* Purpose:
+*	To construct an instance of an Array by taking over the data of an
+*	expiring Array object instead of copying it.
+*
+* Precondition:
+*	An expiring Array object passed by rvalue ref.
+*
+* Postcondition:
+*	The data members hold the data of the expiring Array, which is
+*	left empty.
+**********************************************************************/
+template <typename T>
+Array<T>::Array(Array<T> && move) noexcept : m_array(move.m_array),
+m_length(move.m_length), m_capacity(move.m_capacity), m_start_index(move.m_start_index),
+m_resource(move.m_resource)
+{
+	//Leave expiring Array empty
+	move.m_array = nullptr;
+	move.m_length = 0;
+	move.m_capacity = 0;
+	move.m_start_index = 0;
+}
+
 /**********************************************************************
 * Purpose:
 *	To deallocate the pointer to the dynamic array of data,
@@ -179,11 +475,12 @@ m_length(copy.m_length), m_start_index(copy.m_start_index)
 template <typename T>
 Array<T>::~Array()
 {
-	delete[] m_array;
+	ArrayStorage<T>::Free(m_resource, m_array, m_capacity);
 
 	//Reset to default values
 	m_array = nullptr;
 	m_length = 0;
+	m_capacity = 0;
 	m_start_index = 0;
 }
 
@@ -197,7 +494,8 @@ Array<T>::~Array()
 *
 * Postcondition:
 *	One existing Array object is assigned to another existing Array
-*	object.
+*	object. Storage that is big enough is kept, even when the rhs is
+*	empty, so later games can reuse it.
 **********************************************************************/
 template <typename T>
 Array<T> & Array<T>::operator=(const Array<T> & rhs)
@@ -205,28 +503,75 @@ Array<T> & Array<T>::operator=(const Array<T> & rhs)
 	//If object addresses are not the same
 	if (this != &rhs)
 	{
-		delete[] m_array;
-		m_length = rhs.m_length;
 		m_start_index = rhs.m_start_index;
 
-		//If lenth is zero
+		//If lenth is zero, keep the storage for a later Resize()
 		if (rhs.m_length == 0)
-		{
-			m_array = nullptr;
-		}
+			m_length = 0;
 		//Else lhs array is given length of rhs array
 		else
 		{
-			m_array = new T[rhs.m_length];
+			//Only allocate if current storage is too small
+			if (rhs.m_length > m_capacity)
+			{
+				ArrayStorage<T>::Free(m_resource, m_array, m_capacity);
+				m_array = nullptr;
+				m_length = 0;
+				m_capacity = 0;
+
+				m_array = ArrayStorage<T>::Allocate(m_resource, rhs.m_length);
+				m_capacity = rhs.m_length;
+			}
 
-			for (int i = 0; i < m_length; i++)
-				m_array[i] = rhs.m_array[i];
+			m_length = rhs.m_length;
+			ArrayStorage<T>::Copy(m_array, rhs.m_array, m_length);
 		}
 	}
 
 	return *this;
 }
 
+/**********************************************************************
+* Purpose:
+*	To assign an expiring Array object to an existing Array object by
+*	taking over its data instead of copying it.
+*
+* Precondition:
+*	An expiring Array object passed by rvalue ref.
+*
+* Postcondition:
+*	The existing Array holds the data of the expiring Array, which is
+*	left holding the old data of the existing Array until it is
+*	destroyed.
+**********************************************************************/
+template <typename T>
+Array<T> & Array<T>::operator=(Array<T> && rhs) noexcept
+{
+	swap(rhs);
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To exchange the data of two Arrays without copying any elements.
+*
+* Precondition:
+*	An existing Array object passed by ref.
+*
+* Postcondition:
+*	Each Array holds the data the other held before.
+**********************************************************************/
+template <typename T>
+void Array<T>::swap(Array<T> & other) noexcept
+{
+	std::swap(m_array, other.m_array);
+	std::swap(m_length, other.m_length);
+	std::swap(m_capacity, other.m_capacity);
+	std::swap(m_start_index, other.m_start_index);
+	std::swap(m_resource, other.m_resource);
+}
+
 /**********************************************************************
 * Purpose:
 *	To overload the [] operator in order to behave correctly with
@@ -259,6 +604,45 @@ T & Array<T>::operator[](int index) const
 		return m_array[index - m_start_index];
 }
 
+/**********************************************************************
+* Purpose:
+*	To access an element with the same bounds checks as the []
+*	operator.
+*
+* Precondition:
+*	An integer representing the desired index.
+*
+* Postcondition:
+*	The element of the Array at the desired index location is
+*	returned, or an Exception is thrown if it is out of bounds.
+**********************************************************************/
+template <typename T>
+T & Array<T>::at(int index) const
+{
+	return (*this)[index];
+}
+
+/**********************************************************************
+* Purpose:
+*	To access an element without bounds checks, for loops whose
+*	indices are already known to be valid.
+*
+* Precondition:
+*	An integer representing a valid index.
+*
+* Postcondition:
+*	The element of the Array at the desired index location is
+*	returned. Bounds are only asserted, when ARRAY_ASSERT_BOUNDS is
+*	defined.
+**********************************************************************/
+template <typename T>
+T & Array<T>::operator()(int index) const
+{
+	ARRAY_BOUNDS_ASSERT(index >= m_start_index && index < m_length + m_start_index);
+
+	return m_array[index - m_start_index];
+}
+
 /**********************************************************************
 * Purpose:
 *	To retrieve the value of the starting index.
@@ -327,35 +711,132 @@ void Array<T>::setLength(int length)
 	//If length is greater than zero
 	if (length > 0)
 	{
-		T * newArray = new T[length];	//Give new array the new length
-		int smallestLength = 0;			//Will store length of shortest array
-
-		//If original array has shorter length
-		if (m_length < length)
-			smallestLength = m_length;
-
-		//Else new array will have shorter length
-		else
-			smallestLength = length;
-
-		//Assign contents of original array to new array
-		for (int i = 0; i < smallestLength; i++)
-			newArray[i] = m_array[i];
-
-		delete[] m_array;
-		m_array = newArray;
+		//Give array the new length, keeping contents of original array
+		//(trivially copyable types are realloc'd in place when possible)
+		m_array = ArrayStorage<T>::Reallocate(m_resource, m_array, m_capacity, m_length, length);
 		m_length = length;
+		m_capacity = length;
 	}
 	//Else length is zero
 	else if (length == 0)
 	{
-		delete[] m_array;
+		ArrayStorage<T>::Free(m_resource, m_array, m_capacity);
 		m_array = nullptr;
 		m_length = length;
+		m_capacity = 0;
 	}
 	//Else length cannot be negative
 	else
 		throw Exception("ERROR: Array of negative length not allowed.");
 }
 
+/**********************************************************************
+* Purpose:
+*	To retrieve the number of elements the current storage can hold.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The capacity of the storage is returned.
+**********************************************************************/
+template <typename T>
+int Array<T>::getCapacity() const
+{
+	return m_capacity;
+}
+
+/**********************************************************************
+* Purpose:
+*	To give the Array a new length without keeping its data. The
+*	current storage is reused if it can hold the new length, so an
+*	Array that is resized to the same length again and again only
+*	allocates the first time.
+*
+* Precondition:
+*	An integer representing the desired length.
+*
+* Postcondition:
+*	The Array has the new length and every element holds its default
+*	value, only if the parameter is non-negative; else, an Exception
+*	is thrown.
+**********************************************************************/
+template <typename T>
+void Array<T>::Resize(int length)
+{
+	//Length cannot be negative
+	if (length < 0)
+		throw Exception("ERROR: Array of negative length not allowed.");
+
+	//Only allocate if current storage is too small
+	if (length > m_capacity)
+	{
+		ArrayStorage<T>::Free(m_resource, m_array, m_capacity);
+		m_array = nullptr;
+		m_length = 0;
+		m_capacity = 0;
+
+		//Fresh storage already holds default values
+		m_array = ArrayStorage<T>::Allocate(m_resource, length);
+		m_capacity = length;
+		m_length = length;
+	}
+	else
+	{
+		//Every reused element starts over at its default value
+		m_length = length;
+		ArrayStorage<T>::Reset(m_array, m_length);
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To give the Array zero length while keeping its storage, so it can
+*	be resized again later without allocating.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The Array has zero length and the same capacity as before.
+**********************************************************************/
+template <typename T>
+void Array<T>::Reset()
+{
+	m_length = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the resource the Array gets its storage from.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The resource is returned.
+**********************************************************************/
+template <typename T>
+MemoryResource * Array<T>::getMemoryResource() const
+{
+	return m_resource;
+}
+
+/**********************************************************************
+* Purpose:
+*	To let generic code (and std::swap callers using ADL) exchange two
+*	Arrays without copying them.
+*
+* Precondition:
+*	Two existing Array objects passed by ref.
+*
+* Postcondition:
+*	Each Array holds the data the other held before.
+**********************************************************************/
+template <typename T>
+void swap(Array<T> & lhs, Array<T> & rhs) noexcept
+{
+	lhs.swap(rhs);
+}
+
 #endif //ARRAY_H
\ No newline at end of file
@@ -2,7 +2,7 @@
 * Author:			Molli Drivdahl
 * Filename:			array2D.h
 * Date Created:		1/8/16
-* Modifications:	1/12/16
+* Modifications:	10/17/26
 *
 * Class: Array2D
 *
@@ -15,16 +15,31 @@
 *	Array2D()
 *		Creates an Array2D with zero rows and columns initially.
 *
-*	Array2D(int row, int col)
+*	Array2D(int row, int col, bool padded = false,
+*			MemoryResource * resource = nullptr)
 *		Creates an Array2D with the number of rows and columns as
-*		specified in the parameters.
+*		specified in the parameters, optionally with a padding ring.
+*		Storage comes from the given resource, or the heap by default.
+*
+*	explicit Array2D(MemoryResource * resource)
+*		Creates an empty Array2D that will get its storage from the
+*		given resource.
 *
 *	Array2D(const Array2D<T> & copy)
 *
+*	Array2D(Array2D<T> && move)
+*		Takes over the data of an expiring Array2D without copying it.
+*
 *	~Array2D()
 *
 *	Array2D<T> & operator=(const Array2D<T> & rhs)
 *
+*	Array2D<T> & operator=(Array2D<T> && rhs)
+*		Takes over the data of an expiring Array2D without copying it.
+*
+*	void swap(Array2D<T> & other)
+*		Exchanges the data of two Array2Ds without copying it.
+*
 * Methods:
 *	int getRow() const
 *		Returns value of the number of rows.
@@ -38,16 +53,63 @@
 *	void setColumn(int col)
 *		Sets value of the number of columns.
 *
-*	const Row<T> operator[](int rowDesired) const
+*	void Resize(int row, int col)
+*		Sets both the number of rows and columns at once with every
+*		element reset to its default value, allocating at most once
+*		and not at all if the current storage is big enough.
+*
+*	void Reset()
+*		Gives the Array2D zero rows and columns but keeps its storage
+*		so a later Resize() can reuse it.
+*
+*	const Row<T> operator[](int rowDesired)
+*	const ConstRow<T> operator[](int rowDesired) const
 *		Overloads the [] operator to specify a desired row index of the
 *		Array2D, allowing a Row object to be returned in order to call
 *		the overloaded [] operator in the Row object to specify a
-*		desired column index of the Array2D.
+*		desired column index of the Array2D. A const Array2D returns a
+*		ConstRow, which only gives read access.
+*
+*	T & at(int rowDesired, int columnDesired) const
+*		Returns the element at a row and column pair, throwing an
+*		Exception if either index is out of bounds.
+*
+*	T & operator()(int rowDesired, int columnDesired)
+*	const T & operator()(int rowDesired, int columnDesired) const
+*		Return the element at a row and column pair without bounds
+*		checks or a Row object. The bounds are only asserted, when
+*		ARRAY_ASSERT_BOUNDS is defined.
 *
 *	T & Select(int rowDesired, int columnDesired) const
 *		Select a desired element of the Array2D by taking a desired
 *		row and column pair as parameters and converting to a valid
 *		index of row-major order.
+*
+*	bool isPadded() const
+*		Returns whether the Array2D has a padding ring.
+*
+*	void setPadded(bool padded)
+*		Adds or removes the padding ring, keeping the current data.
+*
+*	int getStride() const
+*		Returns the distance between the starts of two stored rows.
+*
+*	T * RawRow(int rowDesired)
+*	const T * RawRow(int rowDesired) const
+*		Return a pointer to column zero of a row, without any bounds
+*		checks on the columns reached through it. A const Array2D
+*		only gives read access.
+*
+*	void FillHalo(const T & sentinel)
+*		Sets every element of the padding ring to the sentinel value.
+*
+* Padding:
+*	A padded Array2D stores a ring one element wide around the logical
+*	array. getRow() and getColumn() still report the logical size and
+*	the [] operators still only reach logical elements, but RawRow()
+*	can reach rows -1 and getRow(), and each raw row can be indexed
+*	from -1 up to getColumn(). Filling the ring with a sentinel lets
+*	neighbor loops run without edge checks.
 **********************************************************************/
 
 #ifndef ARRAY2D_H
@@ -58,6 +120,9 @@
 template <typename T>
 class Row;
 
+template <typename T>
+class ConstRow;
+
 template <typename T>
 class Array2D
 {
@@ -65,18 +130,30 @@ public:
 	//Default Ctor
 	Array2D();
 
-	//Overloaded 2-arg Ctor
-	Array2D(int row, int col);	//Total # rows, Total # columns
+	//Overloaded 4-arg Ctor
+	Array2D(int row, int col, bool padded = false, MemoryResource * resource = nullptr);	//Total # rows, Total # columns
+
+	//Empty Array2D drawing storage from a resource
+	explicit Array2D(MemoryResource * resource);
 
 	//Copy Ctor
 	Array2D(const Array2D<T> & copy);
 
+	//Move Ctor
+	Array2D(Array2D<T> && move) noexcept;
+
 	//Default Dtor
 	~Array2D();
 
 	//Assignment Operator
 	Array2D<T> & operator=(const Array2D<T> & rhs);
 
+	//Move Assignment Operator
+	Array2D<T> & operator=(Array2D<T> && rhs) noexcept;
+
+	//Exchange data with another Array2D
+	void swap(Array2D<T> & other) noexcept;
+
 	//Getters for m_row and m_col
 	int getRow() const;
 	int getColumn() const;
@@ -85,16 +162,46 @@ public:
 	void setRow(int row);
 	void setColumn(int col);
 
-	//Overloaded [] Operator
-	const Row<T> operator[](int rowDesired) const;
+	//Discard data & set both sizes, reusing storage when possible
+	void Resize(int row, int col);
+
+	//Discard data but keep storage
+	void Reset();
+
+	//Overloaded [] Operators
+	const Row<T> operator[](int rowDesired);
+	const ConstRow<T> operator[](int rowDesired) const;
+
+	//Checked & unchecked element access
+	T & at(int rowDesired, int columnDesired) const;
+	T & operator()(int rowDesired, int columnDesired);
+	const T & operator()(int rowDesired, int columnDesired) const;
 
 	//Selects array element from row-major order
 	T & Select(int rowDesired, int columnDesired) const;
 
+	//Getter and setter for m_padded
+	bool isPadded() const;
+	void setPadded(bool padded);
+
+	//Distance between the starts of two stored rows
+	int getStride() const;
+
+	//Unchecked access to a whole row, including the padding ring
+	T * RawRow(int rowDesired);
+	const T * RawRow(int rowDesired) const;
+
+	//Set every element of the padding ring
+	void FillHalo(const T & sentinel);
+
 private:
+	//Move data into storage of a new size and padding
+	void Relayout(int row, int col, bool padded);
+
 	Array<T> m_array1D;		//1D array to store actual array data
 	int m_row;		//Total # rows
 	int m_col;		//Total # columns
+	bool m_padded;	//Whether a padding ring surrounds the data
 };
 
 /**********************************************************************
@@ -109,7 +216,24 @@ private:
 *	Data members are initialized to default values.
 **********************************************************************/
 template <typename T>
-Array2D<T>::Array2D() : m_row(0), m_col(0)
+Array2D<T>::Array2D() : m_row(0), m_col(0), m_padded(false)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct an empty Array2D that will get its storage from the
+*	given resource.
+*
+* Precondition:
+*	The resource to get storage from (nullptr for the heap). The
+*	resource must outlive the Array2D.
+*
+* Postcondition:
+*	Data members are initialized to default values.
+**********************************************************************/
+template <typename T>
+Array2D<T>::Array2D(MemoryResource * resource) : m_array1D(resource), m_row(0),
+m_col(0), m_padded(false)
 {}
 
 /**********************************************************************
@@ -119,14 +243,16 @@ Array2D<T>::Array2D() : m_row(0), m_col(0)
 *
 * Precondition:
 *	Two intergers specifying the number of rows and columns for the
-*	Array2D.
+*	Array2D, whether it should have a padding ring, and the resource
+*	to get storage from (nullptr for the heap).
 *
 * Postcondition:
 *	The data members are initialized to the values of the parameters,
 *	if desired length is not negative.
 **********************************************************************/
 template <typename T>
-Array2D<T>::Array2D(int row, int col) : m_row(row), m_col(col)
+Array2D<T>::Array2D(int row, int col, bool padded, MemoryResource * resource) :
+m_array1D(resource), m_row(row), m_col(col), m_padded(false)
 {
 	//If either row or column is negative
 	if (row < 0 || col < 0)
@@ -145,7 +271,10 @@ Array2D<T>::Array2D(int row, int col) : m_row(row), m_col(col)
 	}
 
 	//Set the length of the 1D array
-	m_array1D.setLength(row * col);
+	m_array1D.setLength(m_row * m_col);
+
+	//Add the padding ring if wanted
+	setPadded(padded);
 }
 
 /**********************************************************************
@@ -163,7 +292,7 @@ Array2D<T>::Array2D(int row, int col) : m_row(row), m_col(col)
 *	negative row or column values.
 **********************************************************************/
 template <typename T>
-Array2D<T>::Array2D(const Array2D<T> & copy) : m_row(0), m_col(0)
+Array2D<T>::Array2D(const Array2D<T> & copy) : m_row(0), m_col(0), m_padded(copy.m_padded)
 {
 	//If either row or column of existing Array2D is negative
 	if (copy.m_row < 0 || copy.m_col < 0)
@@ -181,6 +310,28 @@ Array2D<T>::Array2D(const Array2D<T> & copy) : m_row(0), m_col(0)
 		*this = copy;	//Use assignment operator
 }
 
+/**********************************************************************
+* Purpose:
+*	To construct an instance of an Array2D by taking over the data of
+*	an expiring Array2D object instead of copying it.
+*
+* Precondition:
+*	An expiring Array2D object passed by rvalue ref.
+*
+* Postcondition:
+*	The data members hold the data of the expiring Array2D, which is
+*	left empty.
+**********************************************************************/
+template <typename T>
+Array2D<T>::Array2D(Array2D<T> && move) noexcept : m_array1D(std::move(move.m_array1D)),
+m_row(move.m_row), m_col(move.m_col), m_padded(move.m_padded)
+{
+	//Leave expiring Array2D empty
+	move.m_row = 0;
+	move.m_col = 0;
+	move.m_padded = false;
+}
+
 /**********************************************************************
 * Purpose:
 *	To reset the data members to default values, and destroy the
@@ -220,11 +371,52 @@ Array2D<T> & Array2D<T>::operator=(const Array2D<T> & rhs)
 		m_array1D = rhs.m_array1D;	//Use Array's assignment operator
 		m_row = rhs.m_row;
 		m_col = rhs.m_col;
+		m_padded = rhs.m_padded;
 	}
 
 	return *this;
 }
 
+/**********************************************************************
+* Purpose:
+*	To assign an expiring Array2D object to an existing Array2D object
+*	by taking over its data instead of copying it.
+*
+* Precondition:
+*	An expiring Array2D object passed by rvalue ref.
+*
+* Postcondition:
+*	The existing Array2D holds the data of the expiring Array2D, which
+*	is left holding the old data of the existing Array2D until it is
+*	destroyed.
+**********************************************************************/
+template <typename T>
+Array2D<T> & Array2D<T>::operator=(Array2D<T> && rhs) noexcept
+{
+	swap(rhs);
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To exchange the data of two Array2Ds without copying any elements.
+*
+* Precondition:
+*	An existing Array2D object passed by ref.
+*
+* Postcondition:
+*	Each Array2D holds the data the other held before.
+**********************************************************************/
+template <typename T>
+void Array2D<T>::swap(Array2D<T> & other) noexcept
+{
+	m_array1D.swap(other.m_array1D);
+	std::swap(m_row, other.m_row);
+	std::swap(m_col, other.m_col);
+	std::swap(m_padded, other.m_padded);
+}
+
 /**********************************************************************
 * Purpose:
 *	To retrieve the value of the number of rows.
@@ -286,6 +478,12 @@ void Array2D<T>::setRow(int row)
 		m_row = 0;
 		m_col = 0;
 	}
+	//Else if padded, rows are not contiguous in the 1D array
+	else if (m_padded)
+	{
+		Relayout(row, m_col, m_padded);
+		return;
+	}
 
 	m_row = row;
 	m_array1D.setLength(m_row * m_col);		//Set the length of the 1D array
@@ -323,10 +521,15 @@ void Array2D<T>::setColumn(int col)
 		m_col = 0;
 		m_array1D.setLength(m_row * m_col);		//Use Array1D to set length to zero
 	}
+	//Else if padded, move each row into its new padded location
+	else if (m_padded)
+	{
+		Relayout(m_row, col, m_padded);
+	}
 	//Else adjust current data of array based on new column size
 	else
 	{
-		Array<T> tempArray(m_row * col);	//Temp 1D array with new length
+		Array<T> tempArray(m_row * col, 0, m_array1D.getMemoryResource());	//Temp 1D array with new length
 
 		//If increasing # of columns
 		if (col > m_col)
@@ -373,11 +576,65 @@ void Array2D<T>::setColumn(int col)
 			}
 		}
 
-		m_array1D = tempArray;
+		m_array1D = std::move(tempArray);
 		m_col = col;
 	}
 }
 
+/**********************************************************************
+* Purpose:
+*	To set the number of rows and columns at once without keeping the
+*	current data. Unlike calling setRow() and then setColumn(), this
+*	allocates at most once and does no relayout, and it reuses the
+*	current storage (padding ring included) when it is big enough.
+*
+* Precondition:
+*	Two integers specifying the desired number of rows and columns.
+*
+* Postcondition:
+*	The Array2D has the new size, keeps its padding mode, and every
+*	element holds its default value, unless either size is negative.
+*	If either size is zero, both are.
+**********************************************************************/
+template <typename T>
+void Array2D<T>::Resize(int row, int col)
+{
+	//If either row or column is negative
+	if (row < 0 || col < 0)
+		throw Exception("ERROR: Cannot set row or column sizes to negative values.");
+
+	//Zero rows or columns means no data at all
+	int length = 0;
+	if (row != 0 && col != 0)
+		length = m_padded ? (row + 2) * (col + 2) : row * col;
+
+	m_array1D.Resize(length);
+
+	//Zero rows or columns means both are zero, as in setRow()/setColumn()
+	m_row = (length != 0) ? row : 0;
+	m_col = (length != 0) ? col : 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To give the Array2D zero rows and columns while keeping its
+*	storage for a later Resize().
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The Array2D has no rows or columns and keeps its capacity and
+*	padding mode.
+**********************************************************************/
+template <typename T>
+void Array2D<T>::Reset()
+{
+	m_array1D.Reset();
+	m_row = 0;
+	m_col = 0;
+}
+
 /**********************************************************************
 * Purpose:
 *	To overload the [] operator to specify a desired row index of the
@@ -393,7 +650,7 @@ void Array2D<T>::setColumn(int col)
 *	is returned.
 **********************************************************************/
 template<typename T>
-const Row<T> Array2D<T>::operator[](int rowDesired) const
+const Row<T> Array2D<T>::operator[](int rowDesired)
 {
 	//If accessing invalid row index value
 	if (rowDesired < 0 || rowDesired >(m_row - 1))
@@ -403,6 +660,98 @@ const Row<T> Array2D<T>::operator[](int rowDesired) const
 	return Row<T>(*this, rowDesired);
 }
 
+/**********************************************************************
+* Purpose:
+*	To overload the [] operator of a const Array2D to specify a desired
+*	row index, returning a ConstRow so the column element it reaches
+*	can only be read.
+*
+* Precondition:
+*	An integer representing the desired row index.
+*
+* Postcondition:
+*	If row index value is valid, a ConstRow object is returned, else
+*	an Exception is thrown.
+**********************************************************************/
+template<typename T>
+const ConstRow<T> Array2D<T>::operator[](int rowDesired) const
+{
+	//If accessing invalid row index value
+	if (rowDesired < 0 || rowDesired >(m_row - 1))
+		throw Exception("ERROR: Array row index is out of bounds.");
+
+	//Instantiate and return ConstRow object
+	return ConstRow<T>(*this, rowDesired);
+}
+
+/**********************************************************************
+* Purpose:
+*	To access an element with the same bounds checks as the [][]
+*	operators, without building a Row object.
+*
+* Precondition:
+*	Two integers specifying the desired row and column pair.
+*
+* Postcondition:
+*	The element at the row and column pair is returned, or an
+*	Exception is thrown if either index is out of bounds.
+**********************************************************************/
+template<typename T>
+T & Array2D<T>::at(int rowDesired, int columnDesired) const
+{
+	//If accessing invalid row index value
+	if (rowDesired < 0 || rowDesired >(m_row - 1))
+		throw Exception("ERROR: Array row index is out of bounds.");
+
+	//If accessing invalid column index value
+	if (columnDesired < 0 || columnDesired >(m_col - 1))
+		throw Exception("ERROR: Array column index is out of bounds.");
+
+	return Select(rowDesired, columnDesired);
+}
+
+/**********************************************************************
+* Purpose:
+*	To access an element without bounds checks, for loops whose
+*	indices are already known to be valid.
+*
+* Precondition:
+*	Two integers specifying a valid row and column pair.
+*
+* Postcondition:
+*	The element at the row and column pair is returned. Bounds are
+*	only asserted, when ARRAY_ASSERT_BOUNDS is defined.
+**********************************************************************/
+template<typename T>
+T & Array2D<T>::operator()(int rowDesired, int columnDesired)
+{
+	ARRAY_BOUNDS_ASSERT(rowDesired >= 0 && rowDesired < m_row);
+	ARRAY_BOUNDS_ASSERT(columnDesired >= 0 && columnDesired < m_col);
+
+	return RawRow(rowDesired)[columnDesired];
+}
+
+/**********************************************************************
+* Purpose:
+*	To read an element of a const Array2D without bounds checks, for
+*	loops whose indices are already known to be valid.
+*
+* Precondition:
+*	Two integers specifying a valid row and column pair.
+*
+* Postcondition:
+*	The element at the row and column pair is returned. Bounds are
+*	only asserted, when ARRAY_ASSERT_BOUNDS is defined.
+**********************************************************************/
+template<typename T>
+const T & Array2D<T>::operator()(int rowDesired, int columnDesired) const
+{
+	ARRAY_BOUNDS_ASSERT(rowDesired >= 0 && rowDesired < m_row);
+	ARRAY_BOUNDS_ASSERT(columnDesired >= 0 && columnDesired < m_col);
+
+	return RawRow(rowDesired)[columnDesired];
+}
+
 /**********************************************************************
 * Purpose:
 *	To select the desired element of the Array2D by taking the desired
@@ -423,8 +772,201 @@ T & Array2D<T>::Select(int rowDesired, int columnDesired) const
 	//Store row and column pair as a row-major ordered index value
 	int indexRowMajorOrder = (rowDesired * m_col) + columnDesired;
 
+	//Skip the padding ring if there is one
+	if (m_padded)
+		indexRowMajorOrder = ((rowDesired + 1) * (m_col + 2)) + columnDesired + 1;
+
 	//Return desired index of array
 	return m_array1D[indexRowMajorOrder];
 }
 
+/**********************************************************************
+* Purpose:
+*	To retrieve whether the Array2D has a padding ring.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	A bool specifying whether the Array2D is padded is returned.
+**********************************************************************/
+template<typename T>
+bool Array2D<T>::isPadded() const
+{
+	return m_padded;
+}
+
+/**********************************************************************
+* Purpose:
+*	To add or remove the padding ring around the Array2D.
+*
+* Precondition:
+*	A bool specifying whether the Array2D should be padded.
+*
+* Postcondition:
+*	The Array2D is padded as specified and keeps its current data. A
+*	new padding ring holds default values until FillHalo() is called.
+**********************************************************************/
+template<typename T>
+void Array2D<T>::setPadded(bool padded)
+{
+	if (padded != m_padded)
+		Relayout(m_row, m_col, padded);
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the distance between the starts of two stored rows.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of elements from one row to the next is returned.
+**********************************************************************/
+template<typename T>
+int Array2D<T>::getStride() const
+{
+	return m_padded ? m_col + 2 : m_col;
+}
+
+/**********************************************************************
+* Purpose:
+*	To give direct access to a whole row of the Array2D. Columns
+*	reached through the returned pointer are not bounds checked.
+*
+* Precondition:
+*	An integer specifying the desired row. A padded Array2D also
+*	allows rows -1 and getRow(), which are part of the padding ring.
+*
+* Postcondition:
+*	A pointer to column zero of the row is returned. For a padded
+*	Array2D, columns -1 and getColumn() of the row are padding.
+**********************************************************************/
+template<typename T>
+T * Array2D<T>::RawRow(int rowDesired)
+{
+	//Same row as the const version, w/write access
+	return const_cast<T *>(static_cast<const Array2D<T> &>(*this).RawRow(rowDesired));
+}
+
+/**********************************************************************
+* Purpose:
+*	To give read access to a whole row of a const Array2D. Columns
+*	reached through the returned pointer are not bounds checked.
+*
+* Precondition:
+*	An integer specifying the desired row. A padded Array2D also
+*	allows rows -1 and getRow(), which are part of the padding ring.
+*
+* Postcondition:
+*	A pointer to column zero of the row is returned. For a padded
+*	Array2D, columns -1 and getColumn() of the row are padding.
+**********************************************************************/
+template<typename T>
+const T * Array2D<T>::RawRow(int rowDesired) const
+{
+	//Padded arrays also allow the rows of the padding ring
+	ARRAY_BOUNDS_ASSERT(m_padded ? (rowDesired >= -1 && rowDesired <= m_row) : (rowDesired >= 0 && rowDesired < m_row));
+
+	//Index of column zero of the row in the 1D array
+	int index = m_padded ? ((rowDesired + 1) * (m_col + 2)) + 1 : rowDesired * m_col;
+
+	return &m_array1D(index);
+}
+
+/**********************************************************************
+* Purpose:
+*	To set every element of the padding ring to a sentinel value.
+*
+* Precondition:
+*	A sentinel value to store in the ring.
+*
+* Postcondition:
+*	If the Array2D is padded and not empty, every ring element holds
+*	the sentinel value.
+**********************************************************************/
+template<typename T>
+void Array2D<T>::FillHalo(const T & sentinel)
+{
+	//Only padded arrays with data have a ring
+	if (!m_padded || m_row == 0 || m_col == 0)
+		return;
+
+	//Top and bottom rows of the ring, corners included
+	T * top = RawRow(-1);
+	T * bottom = RawRow(m_row);
+	for (int j = -1; j <= m_col; j++)
+	{
+		top[j] = sentinel;
+		bottom[j] = sentinel;
+	}
+
+	//Left and right columns of the ring
+	for (int i = 0; i < m_row; i++)
+	{
+		T * row = RawRow(i);
+		row[-1] = sentinel;
+		row[m_col] = sentinel;
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To move the data of the Array2D into storage for a new size and
+*	padding, keeping every element that fits in the new size.
+*
+* Precondition:
+*	Two non-negative integers specifying the new number of rows and
+*	columns, and whether the new storage is padded.
+*
+* Postcondition:
+*	The Array2D has the new size and padding. Elements inside both the
+*	old and new size keep their values.
+**********************************************************************/
+template<typename T>
+void Array2D<T>::Relayout(int row, int col, bool padded)
+{
+	//Zero rows or columns means no data at all
+	int length = 0;
+	if (row != 0 && col != 0)
+		length = padded ? (row + 2) * (col + 2) : row * col;
+
+	Array<T> tempArray(length, 0, m_array1D.getMemoryResource());	//Temp 1D array with new layout
+
+	//Copy every element that exists in both layouts
+	int copyRows = (row < m_row) ? row : m_row;
+	int copyCols = (col < m_col) ? col : m_col;
+	int newStride = padded ? col + 2 : col;
+	int newOffset = padded ? newStride + 1 : 0;
+
+	for (int i = 0; i < copyRows; i++)
+	{
+		for (int j = 0; j < copyCols; j++)
+			tempArray[newOffset + (i * newStride) + j] = Select(i, j);
+	}
+
+	m_array1D = std::move(tempArray);
+	m_row = row;
+	m_col = col;
+	m_padded = padded;
+}
+
+/**********************************************************************
+* Purpose:
+*	To let generic code (and std::swap callers using ADL) exchange two
+*	Array2Ds without copying them.
+*
+* Precondition:
+*	Two existing Array2D objects passed by ref.
+*
+* Postcondition:
+*	Each Array2D holds the data the other held before.
+**********************************************************************/
+template <typename T>
+void swap(Array2D<T> & lhs, Array2D<T> & rhs) noexcept
+{
+	lhs.swap(rhs);
+}
+
 #endif //ARRAY2D_H
\ No newline at end of file
@@ -0,0 +1,329 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			bitplane.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "bitplane.h"
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a BitPlane with zero rows and columns.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are initialized to default values.
+**********************************************************************/
+BitPlane::BitPlane() : m_row(0), m_col(0), m_stride(0)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a BitPlane of the specified size with
+*	every bit cleared.
+*
+* Precondition:
+*	Two integers specifying the number of rows and columns.
+*
+* Postcondition:
+*	The BitPlane has the specified size and every bit is cleared.
+**********************************************************************/
+BitPlane::BitPlane(int row, int col) : m_row(0), m_col(0), m_stride(0)
+{
+	Resize(row, col);
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct an empty BitPlane that will get its storage from the
+*	given resource.
+*
+* Precondition:
+*	The resource to get storage from (nullptr for the heap). The
+*	resource must outlive the BitPlane.
+*
+* Postcondition:
+*	The BitPlane has zero rows and columns.
+**********************************************************************/
+BitPlane::BitPlane(MemoryResource * resource) : m_words(resource), m_row(0),
+m_col(0), m_stride(0)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a BitPlane with data members whose
+*	initial values are copied from an existing BitPlane object.
+*
+* Precondition:
+*	An existing BitPlane object passed by const ref.
+*
+* Postcondition:
+*	The data members are initialized to the values of the data members
+*	of the existing BitPlane object.
+**********************************************************************/
+BitPlane::BitPlane(const BitPlane & copy) : m_row(0), m_col(0), m_stride(0)
+{
+	*this = copy;	//Use assignment operator
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a BitPlane by taking over the data of
+*	an expiring BitPlane object instead of copying it.
+*
+* Precondition:
+*	An expiring BitPlane object passed by rvalue ref.
+*
+* Postcondition:
+*	The data members hold the data of the expiring BitPlane, which is
+*	left empty.
+**********************************************************************/
+BitPlane::BitPlane(BitPlane && move) noexcept : m_words(std::move(move.m_words)),
+m_row(move.m_row), m_col(move.m_col), m_stride(move.m_stride)
+{
+	//Leave expiring BitPlane empty
+	move.m_row = 0;
+	move.m_col = 0;
+	move.m_stride = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To reset the data members to default values, and destroy the
+*	BitPlane.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are reset to default values.
+**********************************************************************/
+BitPlane::~BitPlane()
+{
+	m_row = 0;
+	m_col = 0;
+	m_stride = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To assign one existing BitPlane object to another existing BitPlane
+*	object by copying values of data members from one to another.
+*
+* Precondition:
+*	An existing BitPlane object passed by const ref.
+*
+* Postcondition:
+*	One existing BitPlane object is assigned to another existing
+*	BitPlane object.
+**********************************************************************/
+BitPlane & BitPlane::operator=(const BitPlane & rhs)
+{
+	if (this != &rhs)
+	{
+		//Use Array's assignment operator
+		m_words = rhs.m_words;
+		m_row = rhs.m_row;
+		m_col = rhs.m_col;
+		m_stride = rhs.m_stride;
+	}
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To assign an expiring BitPlane object to an existing BitPlane object
+*	by taking over its data instead of copying it.
+*
+* Precondition:
+*	An expiring BitPlane object passed by rvalue ref.
+*
+* Postcondition:
+*	The existing BitPlane holds the data of the expiring BitPlane, which
+*	is left holding the old data of the existing BitPlane until it is
+*	destroyed.
+**********************************************************************/
+BitPlane & BitPlane::operator=(BitPlane && rhs) noexcept
+{
+	swap(rhs);
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To exchange the data of two BitPlanes without copying any of it.
+*
+* Precondition:
+*	An existing BitPlane object passed by ref.
+*
+* Postcondition:
+*	Each BitPlane holds the data the other held before.
+**********************************************************************/
+void BitPlane::swap(BitPlane & other) noexcept
+{
+	m_words.swap(other.m_words);
+	std::swap(m_row, other.m_row);
+	std::swap(m_col, other.m_col);
+	std::swap(m_stride, other.m_stride);
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the value of the number of rows.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The value of the number of rows is returned.
+**********************************************************************/
+int BitPlane::getRow() const
+{
+	return m_row;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the value of the number of columns.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The value of the number of columns is returned.
+**********************************************************************/
+int BitPlane::getColumn() const
+{
+	return m_col;
+}
+
+/**********************************************************************
+* Purpose:
+*	To give the BitPlane a new size. Each row is padded out to a whole
+*	number of words so that the unused bits at the end of a row always
+*	stay cleared. The current storage is reused if it is big enough.
+*
+* Precondition:
+*	Two integers specifying the number of rows and columns.
+*
+* Postcondition:
+*	The BitPlane has the specified size and every bit is cleared.
+**********************************************************************/
+void BitPlane::Resize(int row, int col)
+{
+	//Cannot have plane of negative size
+	if (row < 0 || col < 0)
+		throw Exception("ERROR: Cannot set row or column sizes to negative values.");
+
+	//Zero rows or columns means an empty plane
+	if (row == 0 || col == 0)
+	{
+		row = 0;
+		col = 0;
+	}
+
+	m_row = row;
+	m_col = col;
+	m_stride = (col + 63) / 64;
+	m_words.Resize(m_row * m_stride);	//Every word starts cleared
+}
+
+/**********************************************************************
+* Purpose:
+*	To determine whether the bit for a cell is set.
+*
+* Precondition:
+*	Two integers specifying a row and column pair inside the plane.
+*
+* Postcondition:
+*	A bool specifying whether the bit is set is returned.
+**********************************************************************/
+bool BitPlane::Get(int row, int col) const
+{
+	return ((m_words(row * m_stride + (col >> 6)) >> (col & 63)) & 1) != 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To set the bit for a cell.
+*
+* Precondition:
+*	Two integers specifying a row and column pair inside the plane.
+*
+* Postcondition:
+*	The bit for the cell is set.
+**********************************************************************/
+void BitPlane::Set(int row, int col)
+{
+	m_words(row * m_stride + (col >> 6)) |= (uint64_t(1) << (col & 63));
+}
+
+/**********************************************************************
+* Purpose:
+*	To clear the bit for a cell.
+*
+* Precondition:
+*	Two integers specifying a row and column pair inside the plane.
+*
+* Postcondition:
+*	The bit for the cell is cleared.
+**********************************************************************/
+void BitPlane::Clear(int row, int col)
+{
+	m_words(row * m_stride + (col >> 6)) &= ~(uint64_t(1) << (col & 63));
+}
+
+/**********************************************************************
+* Purpose:
+*	To count how many cells around a cell have their bit set.
+*
+* Precondition:
+*	Two integers specifying a row and column pair inside the plane.
+*
+* Postcondition:
+*	The number of set bits in the (up to eight) surrounding cells is
+*	returned. The cell itself is not counted.
+**********************************************************************/
+int BitPlane::CountNeighbors(int row, int col) const
+{
+	int count = 0;
+
+	//Check the 3x3 block around the cell, skipping out of bounds cells
+	for (int i = row - 1; i <= row + 1; i++)
+	{
+		if (i < 0 || i >= m_row)
+			continue;
+
+		for (int j = col - 1; j <= col + 1; j++)
+		{
+			if (j < 0 || j >= m_col || (i == row && j == col))
+				continue;
+
+			if (Get(i, j))
+				count++;
+		}
+	}
+
+	return count;
+}
+
+/**********************************************************************
+* Purpose:
+*	To let generic code (and std::swap callers using ADL) exchange two
+*	BitPlanes without copying them.
+*
+* Precondition:
+*	Two existing BitPlane objects passed by ref.
+*
+* Postcondition:
+*	Each BitPlane holds the data the other held before.
+**********************************************************************/
+void swap(BitPlane & lhs, BitPlane & rhs) noexcept
+{
+	lhs.swap(rhs);
+}
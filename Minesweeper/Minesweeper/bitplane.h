@@ -0,0 +1,126 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			bitplane.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: BitPlane
+*
+* Purpose:
+*	This class stores one bit for every cell of a two-dimensional board
+*	in row-major order. Each row starts on a fresh 64-bit word.
+*
+* Manager functions:
+*	BitPlane()
+*		Creates a BitPlane with zero rows and columns.
+*
+*	BitPlane(int row, int col)
+*		Creates a BitPlane with the number of rows and columns as
+*		specified in the parameters, with every bit cleared.
+*
+*	explicit BitPlane(MemoryResource * resource)
+*		Creates an empty BitPlane that will get its storage from the
+*		given resource.
+*
+*	BitPlane(const BitPlane & copy)
+*
+*	BitPlane(BitPlane && move)
+*		Takes over the data of an expiring BitPlane without copying it.
+*
+*	~BitPlane()
+*
+*	BitPlane & operator=(const BitPlane & rhs)
+*
+*	BitPlane & operator=(BitPlane && rhs)
+*		Takes over the data of an expiring BitPlane without copying it.
+*
+*	void swap(BitPlane & other)
+*		Exchanges the data of two BitPlanes without copying it.
+*
+* Methods:
+*	int getRow() const
+*		Returns value of the number of rows.
+*
+*	int getColumn() const
+*		Returns value of the number of columns.
+*
+*	void Resize(int row, int col)
+*		Gives the BitPlane a new size and clears every bit.
+*
+*	bool Get(int row, int col) const
+*		Returns whether the bit for the given cell is set.
+*
+*	void Set(int row, int col)
+*		Sets the bit for the given cell.
+*
+*	void Clear(int row, int col)
+*		Clears the bit for the given cell.
+*
+*	int CountNeighbors(int row, int col) const
+*		Returns how many of the (up to eight) cells around the given
+*		cell have their bit set.
+**********************************************************************/
+
+#ifndef BITPLANE_H
+#define BITPLANE_H
+
+#include "array.h"
+
+#include <cstdint>
+
+class BitPlane
+{
+public:
+	//Default Ctor
+	BitPlane();
+
+	//Overloaded 2-arg Ctor
+	BitPlane(int row, int col);
+
+	//Empty BitPlane drawing storage from a resource
+	explicit BitPlane(MemoryResource * resource);
+
+	//Copy Ctor
+	BitPlane(const BitPlane & copy);
+
+	//Move Ctor
+	BitPlane(BitPlane && move) noexcept;
+
+	//Default Dtor
+	~BitPlane();
+
+	//Assignment Operator
+	BitPlane & operator=(const BitPlane & rhs);
+
+	//Move Assignment Operator
+	BitPlane & operator=(BitPlane && rhs) noexcept;
+
+	//Exchange data with another BitPlane
+	void swap(BitPlane & other) noexcept;
+
+	//Getters for m_row and m_col
+	int getRow() const;
+	int getColumn() const;
+
+	//Give plane a new size with every bit cleared
+	void Resize(int row, int col);
+
+	//Single bit access
+	bool Get(int row, int col) const;
+	void Set(int row, int col);
+	void Clear(int row, int col);
+
+	//Count set bits around a cell
+	int CountNeighbors(int row, int col) const;
+
+private:
+	Array<uint64_t> m_words;	//Bits stored 64 to a word, row-major
+	int m_row;		//Total # rows
+	int m_col;		//Total # columns
+	int m_stride;	//# words per row
+};
+
+//Exchange two BitPlanes without copying them
+void swap(BitPlane & lhs, BitPlane & rhs) noexcept;
+
+#endif //BITPLANE_H
@@ -2,22 +2,94 @@
 * Author:			Molli Drivdahl
 * Filename:			board.cpp
 * Date Created:		1/12/16
-* Modifications:	1/17/16
+* Modifications:	10/17/26
 **********************************************************************/
 
 #include "board.h"
+#include "neighborcount.h"
+#include "random.h"
+#include "threadpool.h"
 
-//Need for randomization
-#include <cstdlib>
-using std::srand;
-#include <ctime>
-using std::time;
+#include <algorithm>
+#include <cassert>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
 
-//Need for colors
-#include <Windows.h>
+//Instantiate every member of the 2D array & its row proxies for Cell, so
+//a member that stops compiling breaks the build even if nothing calls it
+template class Array2D<Cell>;
+template class Row<Cell>;
+template class ConstRow<Cell>;
 
-#include <iostream>
-using std::cout;
+//a[i](j) writes through a non-const Array2D & only reads through a const one
+static_assert(std::is_same<decltype(std::declval<Array2D<Cell> &>()[0](0)), Cell &>::value,
+	"Row of a non-const Array2D must give write access");
+static_assert(std::is_same<decltype(std::declval<const Array2D<Cell> &>()[0](0)), const Cell &>::value,
+	"ConstRow of a const Array2D must only give read access");
+
+/**********************************************************************
+* Purpose:
+*	To create the sentinel Cell stored in the padding ring around a
+*	CELL_BACKEND board. It is uncovered so flood fills stop at it, and
+*	it is not a mine so it adds nothing to any count. Its zero value
+*	is marked counted, so lazy counting never counts around it.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The sentinel Cell is returned.
+**********************************************************************/
+static Cell MakeHaloCell()
+{
+	Cell halo;
+	halo.SetState(UNCOVERED);
+	halo.SetCounted();
+
+	return halo;
+}
+
+/**********************************************************************
+* Purpose:
+*	To map an index among the cells that may get a mine to the cell
+*	it stands for, skipping the excluded cells.
+*
+* Precondition:
+*	The index, the excluded cells in increasing order, and their #.
+*
+* Postcondition:
+*	The cell (row * # columns + column) is returned.
+**********************************************************************/
+static int64_t SkipExcluded(int64_t index, const int64_t * excluded, int numExcluded)
+{
+	for (int k = 0; k < numExcluded && excluded[k] <= index; k++)
+		index++;
+
+	return index;
+}
+
+/**********************************************************************
+* Purpose:
+*	To check if a cell is one of the excluded cells.
+*
+* Precondition:
+*	The cell (row * # columns + column), the excluded cells, and
+*	their #.
+*
+* Postcondition:
+*	A bool specifying whether the cell is excluded is returned.
+**********************************************************************/
+static bool IsExcluded(int64_t cell, const int64_t * excluded, int numExcluded)
+{
+	for (int k = 0; k < numExcluded; k++)
+	{
+		if (excluded[k] == cell)
+			return true;
+	}
+
+	return false;
+}
 
 /**********************************************************************
 * Purpose:
@@ -31,11 +103,36 @@ using std::cout;
 *	Data member containing number of mines is initialized to default
 *	value of zero.
 **********************************************************************/
-Board::Board() : m_numMines(0)
-{
-	//Placed here b/c needs only run once
-	srand((unsigned int)time(NULL));
-}
+Board::Board() : m_numRegions(0), m_regionIndexBuilt(false), m_useRegionIndex(true), m_useLazyValues(false),
+m_backend(CELL_BACKEND), m_numMines(0), m_numCoveredSafe(0), m_numFlags(0),
+m_numMinesFlagged(0), m_numDeltas(0), m_moveNumber(0), m_lastMove(), m_seed(0),
+m_firstClick(FIRST_CLICK_ANY), m_minesPlaced(false),
+m_generation(GENERATE_SHUFFLE), m_threadPool(nullptr)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct an empty Board whose cells, bit planes, and scratch
+*	planes all get their storage from the given resource.
+*
+* Precondition:
+*	The resource to get storage from (nullptr for the heap). The
+*	resource must outlive the Board.
+*
+* Postcondition:
+*	Data member containing number of mines is initialized to default
+*	value of zero.
+**********************************************************************/
+Board::Board(MemoryResource * resource) : m_arrayCells(resource), m_mines(resource),
+m_uncovered(resource), m_flagged(resource), m_mineSet(resource), m_minePlane(resource),
+m_mineCounts(resource), m_fillStack(resource), m_regionIds(resource),
+m_regionStarts(resource), m_regionCells(resource), m_regionTouched(resource), m_numRegions(0),
+m_regionIndexBuilt(false), m_useRegionIndex(true), m_useLazyValues(false), m_backend(CELL_BACKEND), m_numMines(0),
+m_numCoveredSafe(0), m_numFlags(0), m_numMinesFlagged(0), m_deltas(resource),
+m_numDeltas(0), m_moveNumber(0), m_lastMove(), m_seed(0),
+m_firstClick(FIRST_CLICK_ANY), m_minesPlaced(false),
+m_generation(GENERATE_SHUFFLE), m_threadPool(nullptr)
+{}
 
 /**********************************************************************
 * Purpose:
@@ -49,12 +146,59 @@ Board::Board() : m_numMines(0)
 *	The data members are initialized to the values of the data members
 *	of the existing Board object.
 **********************************************************************/
-Board::Board(const Board & copy) : m_numMines(0)
+Board::Board(const Board & copy) : m_numRegions(0), m_regionIndexBuilt(false),
+m_useRegionIndex(true), m_useLazyValues(false), m_backend(CELL_BACKEND), m_numMines(0), m_numCoveredSafe(0),
+m_numFlags(0), m_numMinesFlagged(0), m_numDeltas(0), m_moveNumber(0), m_lastMove(), m_seed(0),
+m_firstClick(FIRST_CLICK_ANY), m_minesPlaced(false),
+m_generation(GENERATE_SHUFFLE), m_threadPool(nullptr)
 {
 	//Use assignment operator
 	*this = copy;
 }
 
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a Board by taking over the data of
+*	an expiring Board object instead of copying it.
+*
+* Precondition:
+*	An expiring Board object passed by rvalue ref.
+*
+* Postcondition:
+*	The data members hold the data of the expiring Board, which is
+*	left empty.
+**********************************************************************/
+Board::Board(Board && move) noexcept : m_arrayCells(std::move(move.m_arrayCells)),
+m_mines(std::move(move.m_mines)), m_uncovered(std::move(move.m_uncovered)),
+m_flagged(std::move(move.m_flagged)), m_mineSet(std::move(move.m_mineSet)),
+m_minePlane(std::move(move.m_minePlane)),
+m_mineCounts(std::move(move.m_mineCounts)), m_fillStack(std::move(move.m_fillStack)),
+m_regionIds(std::move(move.m_regionIds)), m_regionStarts(std::move(move.m_regionStarts)),
+m_regionCells(std::move(move.m_regionCells)), m_regionTouched(std::move(move.m_regionTouched)),
+m_numRegions(move.m_numRegions),
+m_regionIndexBuilt(move.m_regionIndexBuilt), m_useRegionIndex(move.m_useRegionIndex),
+m_useLazyValues(move.m_useLazyValues),
+m_backend(move.m_backend), m_numMines(move.m_numMines), m_numCoveredSafe(move.m_numCoveredSafe),
+m_numFlags(move.m_numFlags), m_numMinesFlagged(move.m_numMinesFlagged),
+m_deltas(std::move(move.m_deltas)), m_numDeltas(move.m_numDeltas), m_moveNumber(move.m_moveNumber),
+m_lastMove(move.m_lastMove), m_seed(move.m_seed), m_firstClick(move.m_firstClick),
+m_minesPlaced(move.m_minesPlaced), m_generation(move.m_generation),
+m_threadPool(move.m_threadPool)
+{
+	//Leave expiring Board empty
+	move.m_numRegions = 0;
+	move.m_regionIndexBuilt = false;
+	move.m_numMines = 0;
+	move.m_numCoveredSafe = 0;
+	move.m_numFlags = 0;
+	move.m_numMinesFlagged = 0;
+	move.m_numDeltas = 0;
+	move.m_moveNumber = 0;
+	move.m_lastMove = CellCoord();
+	move.m_seed = 0;
+	move.m_minesPlaced = false;
+}
+
 /**********************************************************************
 * Purpose:
 *	To reset the data members to default values, and destroy the Board.
@@ -89,9 +233,31 @@ Board & Board::operator=(const Board & rhs)
 {
 	if (this != &rhs)
 	{
-		//Use Array2D's assignment operator
+		//Use Array2D's and BitPlane's assignment operators
 		m_arrayCells = rhs.m_arrayCells;
+		m_mines = rhs.m_mines;
+		m_uncovered = rhs.m_uncovered;
+		m_flagged = rhs.m_flagged;
+		m_mineSet = rhs.m_mineSet;
+		m_backend = rhs.m_backend;
 		m_numMines = rhs.m_numMines;
+		m_numCoveredSafe = rhs.m_numCoveredSafe;
+		m_numFlags = rhs.m_numFlags;
+		m_numMinesFlagged = rhs.m_numMinesFlagged;
+		m_deltas = rhs.m_deltas;
+		m_numDeltas = rhs.m_numDeltas;
+		m_moveNumber = rhs.m_moveNumber;
+		m_lastMove = rhs.m_lastMove;
+		m_seed = rhs.m_seed;
+		m_firstClick = rhs.m_firstClick;
+		m_minesPlaced = rhs.m_minesPlaced;
+		m_generation = rhs.m_generation;
+		m_threadPool = rhs.m_threadPool;	//Pools are shared, not copied
+
+		//Zero-region index is rebuilt when needed
+		m_regionIndexBuilt = false;
+		m_useRegionIndex = rhs.m_useRegionIndex;
+		m_useLazyValues = rhs.m_useLazyValues;
 	}
 
 	return *this;
@@ -99,503 +265,2086 @@ Board & Board::operator=(const Board & rhs)
 
 /**********************************************************************
 * Purpose:
-*	To create the Board with a specified number of rows, columns, and
-*	mines.
+*	To assign an expiring Board object to an existing Board object
+*	by taking over its data instead of copying it.
 *
 * Precondition:
-*	Three integers specifying the number of rows, columns, and mines
-*	to apply to the Board.
+*	An expiring Board object passed by rvalue ref.
 *
 * Postcondition:
-*	A Board with the specified number of rows, columns, and mines is
-*	created. A call to the ShuffleMines() method is made.
+*	The existing Board holds the data of the expiring Board, which
+*	is left holding the old data of the existing Board until it is
+*	destroyed.
 **********************************************************************/
-void Board::CreateBoard(int row, int column, int numMines)
+Board & Board::operator=(Board && rhs) noexcept
 {
-	//Set a board to a specified size
-	m_arrayCells.setRow(row);
-	m_arrayCells.setColumn(column);
-
-	//Store total number of mines
-	m_numMines = numMines;
+	swap(rhs);
 
-	//Randomly assign mines to board
-	ShuffleMines();
+	return *this;
 }
 
 /**********************************************************************
 * Purpose:
-*	To allow the user to uncover a cell on the board, unless the
-*	specified cell is already uncovered, has a flag, or is an invalid
-*	element.
+*	To exchange the data of two Boards without copying any of it.
 *
 * Precondition:
-*	Two integers specifying the row and column pair to uncover.
+*	An existing Board object passed by ref.
 *
 * Postcondition:
-*	The specified cell is uncoverd only if it is a valid cell to
-*	uncover.
+*	Each Board holds the data the other held before.
 **********************************************************************/
-void Board::UncoverCell(int row, int column)
+void Board::swap(Board & other) noexcept
 {
-	try
-	{
-		//See if cell is in bounds (no exception thrown from Array2D)
-		m_arrayCells[row][column];
-	}
-	catch (Exception & ex)
-	{
-		//Catch Array2D exception from accessing invalid elements
-		//Throw new exception to inform the user & leave this method
-		throw Exception("ERROR: That cell is not part of the board.");
-	}
-
-	//If cell is covered
-	if (m_arrayCells[row][column].GetState() == COVERED)
-	{
-		//If cell has no adjacent mines
-		if (m_arrayCells[row][column].GetValue() == NO_ADJ_MINES)
-		{
-			FloodFill(row, column);
-		}
-		else
-		{
-			//Uncover cell
-			m_arrayCells[row][column].SetState(UNCOVERED);
-		}
-	}
-	//Else cannot uncover cell
-	else
-		throw Exception("ERROR: Cannot uncover a cell that is already uncovered or flagged.");
+	m_arrayCells.swap(other.m_arrayCells);
+	m_mines.swap(other.m_mines);
+	m_uncovered.swap(other.m_uncovered);
+	m_flagged.swap(other.m_flagged);
+	m_mineSet.swap(other.m_mineSet);
+	m_minePlane.swap(other.m_minePlane);
+	m_mineCounts.swap(other.m_mineCounts);
+	m_fillStack.swap(other.m_fillStack);
+	m_regionIds.swap(other.m_regionIds);
+	m_regionStarts.swap(other.m_regionStarts);
+	m_regionCells.swap(other.m_regionCells);
+	m_regionTouched.swap(other.m_regionTouched);
+	std::swap(m_numRegions, other.m_numRegions);
+	std::swap(m_regionIndexBuilt, other.m_regionIndexBuilt);
+	std::swap(m_useRegionIndex, other.m_useRegionIndex);
+	std::swap(m_useLazyValues, other.m_useLazyValues);
+	std::swap(m_backend, other.m_backend);
+	std::swap(m_numMines, other.m_numMines);
+	std::swap(m_numCoveredSafe, other.m_numCoveredSafe);
+	std::swap(m_numFlags, other.m_numFlags);
+	std::swap(m_numMinesFlagged, other.m_numMinesFlagged);
+	m_deltas.swap(other.m_deltas);
+	std::swap(m_numDeltas, other.m_numDeltas);
+	std::swap(m_moveNumber, other.m_moveNumber);
+	std::swap(m_lastMove, other.m_lastMove);
+	std::swap(m_seed, other.m_seed);
+	std::swap(m_firstClick, other.m_firstClick);
+	std::swap(m_minesPlaced, other.m_minesPlaced);
+	std::swap(m_generation, other.m_generation);
+	std::swap(m_threadPool, other.m_threadPool);
 }
 
 /**********************************************************************
 * Purpose:
-*	To allow the user to add a flag to a cell on the board, unless
-*	the specified cell already has a flag, is uncovered, or is an
-*	invalid element.
+*	To create the Board with a specified number of rows, columns, and
+*	mines, placed from a seed that differs from game to game.
 *
 * Precondition:
-*	Two integers specifying the row and column pair to add the flag to.
+*	Three integers specifying the number of rows, columns, and mines
+*	to apply to the Board, and the backend to store the Board in.
 *
 * Postcondition:
-*	A flag is added to the specified cell only if it is a valid cell
-*	to add a flag to.
+*	A Board with the specified number of rows, columns, and mines is
+*	created. GetSeed() returns the seed it was made from.
 **********************************************************************/
-void Board::FlagCell(int row, int column)
+void Board::CreateBoard(int row, int column, int numMines, Backend backend)
 {
-	try
-	{
-		//See if cell is in bounds (no exception thrown from Array2D)
-		m_arrayCells[row][column];
-	}
-	catch (Exception & ex)
-	{
-		//Catch Array2D exception from accessing invalid elements
-		//Throw new exception to inform the user & leave this method
-		throw Exception("ERROR: That cell is not part of the board.");
-	}
-
-	//If cell is covered
-	if (m_arrayCells[row][column].GetState() == COVERED)
-	{
-		//Flag cell
-		m_arrayCells[row][column].SetState(FLAGGED);
-	}
-	//Else cannot flag cell
-	else
-		throw Exception("ERROR: Cannot flag a cell that is already uncovered or flagged.");
+	CreateBoard(row, column, numMines, Xoshiro256::MakeSeed(), backend);
 }
 
 /**********************************************************************
 * Purpose:
-*	To allow the user to remove a flag from a cell on the board, unless
-*	the specified cell does not have a flag or is an invalid element.
+*	To create the Board with a specified number of rows, columns, and
+*	mines, placed from the given seed. The same seed, size, and # of
+*	mines always give the same mines, on every platform & backend.
 *
 * Precondition:
-*	Two integers specifying the row and column pair to remove the flag
-*	from.
+*	Three integers specifying the number of rows, columns, and mines
+*	to apply to the Board, the seed to place the mines from, and the
+*	backend to store the Board in.
 *
 * Postcondition:
-*	A flag is removed from the specified cell only if it is a valid
-*	cell to remove a flag from.
+*	A Board with the specified number of rows, columns, and mines is
+*	created. A call to the ShuffleMines() method is made, unless the
+*	mines wait for the first uncover. An Exception is thrown, w/the
+*	Board left as it was, if a size is negative or the # of mines is
+*	not from zero to the # of cells.
 **********************************************************************/
-void Board::RemoveFlaggedCell(int row, int column)
+void Board::CreateBoard(int row, int column, int numMines, uint64_t seed, Backend backend)
 {
-	try
+	//If a size is negative
+	if (row < 0 || column < 0)
+		throw Exception("ERROR: Cannot set row or column sizes to negative values.");
+
+	//If the mines can't all fit (Floyd's algorithm would never end)
+	if (numMines < 0 || numMines > static_cast<int64_t>(row) * column)
+		throw Exception("ERROR: Number of mines must be from zero to the number of cells.");
+
+	//Drop any data left in any backend
+	ResetEmptyBoard();
+
+	//Large boards w/few mines are stored sparse
+	if (backend == AUTO_BACKEND)
 	{
-		//See if cell is in bounds (no exception thrown from Array2D)
-		m_arrayCells[row][column];
+		int64_t numCells = static_cast<int64_t>(row) * column;
+
+		backend = (numCells >= SPARSE_MIN_CELLS &&
+			static_cast<int64_t>(numMines) * SPARSE_CELLS_PER_MINE < numCells) ? SPARSE_BACKEND : CELL_BACKEND;
 	}
-	catch (Exception & ex)
+
+	m_backend = backend;
+
+	//Set a board to a specified size
+	if (m_backend == BITPLANE_BACKEND)
 	{
-		//Catch Array2D exception from accessing invalid elements
-		//Throw new exception to inform the user & leave this method
-		throw Exception("ERROR: That cell is not part of the board.");
+		m_mines.Resize(row, column);
+		m_uncovered.Resize(row, column);
+		m_flagged.Resize(row, column);
 	}
-
-	//If cell is flagged
-	if (m_arrayCells[row][column].GetState() == FLAGGED)
+	else if (m_backend == SPARSE_BACKEND)
 	{
-		//Remove flag and reset to covered
-		m_arrayCells[row][column].SetState(COVERED);
+		//Room for every mine up front, so placing them doesn't rehash
+		m_mineSet.Reserve(numMines);
+		m_uncovered.Resize(row, column);
+		m_flagged.Resize(row, column);
 	}
-	//Else cannot unflag cell
 	else
-		throw Exception("ERROR: Cannot unflag a cell that is not already flagged.");
+	{
+		//Ring of padding cells lets neighbor loops skip edge checks
+		//(Resize reuses the storage left by the last game if it fits)
+		m_arrayCells.setPadded(true);
+		m_arrayCells.Resize(row, column);
+		m_arrayCells.FillHalo(MakeHaloCell());
+	}
+
+	//Store total number of mines & where their placement comes from
+	m_numMines = numMines;
+	m_seed = seed;
+
+	//Randomly assign mines to board, unless first uncover must be safe
+	m_minesPlaced = (m_firstClick == FIRST_CLICK_ANY);
+
+	//(Sparse boards shuffle, since tiles visit every cell)
+	if (m_minesPlaced && m_generation == GENERATE_TILED && m_backend != SPARSE_BACKEND)
+		TileMines(nullptr, 0);
+	else if (m_minesPlaced)
+		ShuffleMines(nullptr, 0);
+
+	//Every non-mine cell starts covered & no cell is flagged
+	m_numCoveredSafe = GetRow() * GetColumn() - m_numMines;
+	m_numFlags = 0;
+	m_numMinesFlagged = 0;
 }
 
 /**********************************************************************
 * Purpose:
-*	To determine whether a particular cell contains a mine.
+*	To choose when the next CreateBoard() places the mines: right
+*	away, or on the first uncover, w/o a mine on that cell (or its
+*	neighbors). Placing them late still takes one pass, so no board
+*	is thrown away for a lost first click.
 *
 * Precondition:
-*	Two integers specifying a row and column pair.
+*	When the mines are to be placed.
 *
 * Postcondition:
-*	A bool specifying whether the particular cell is a mine is
-*	returned.
+*	The setting is stored for the boards CreateBoard() makes.
 **********************************************************************/
-bool Board::IsMine(int row, int column)
+void Board::SetFirstClick(FirstClick firstClick)
 {
-	bool isMine = false;	//Indicates if cell is a mine
-
-	if (m_arrayCells[row][column].GetValue() == MINE)
-		isMine = true;
-
-	return isMine;
+	m_firstClick = firstClick;
 }
 
 /**********************************************************************
 * Purpose:
-*	To uncover more cells upon uncovering a cell w/zero adjacent mines.
-*	Every cell around a cell w/zero adjacent mines will be checked to
-*	determine if it can be uncovered. 
+*	To choose how the next CreateBoard() places the mines. Both ways
+*	make every placement equally likely; GENERATE_TILED splits the
+*	work over a thread pool, which pays off on very large boards.
 *
 * Precondition:
-*	A cell w/zero adjacent mines was uncovered. Two integers specifying
-*	the row and column pair that was uncovered is passed to the method.
+*	How the mines are to be placed.
 *
 * Postcondition:
-*	The method will recursively call itself while more cells w/zero
-*	adjacent mines are uncovered.
+*	The setting is stored for the boards CreateBoard() makes.
 **********************************************************************/
-void Board::FloodFill(int row, int column)
+void Board::SetGeneration(Generation generation)
 {
-	//If cell is in bounds of board
-	if (row != -1 && row != m_arrayCells.getRow() && column != -1 && column != m_arrayCells.getColumn())
-	{
-		//If cell is still covered
-		if (m_arrayCells[row][column].GetState() == COVERED)
-		{
-			//If cell is not a mine
-			if (m_arrayCells[row][column].GetValue() != MINE)
-			{
-				//Uncover cell
-				m_arrayCells[row][column].SetState(UNCOVERED);
-
-				//If cell has no adjacent mines
-				if (m_arrayCells[row][column].GetValue() == NO_ADJ_MINES)
-				{
-					//Continue flood fill effect
-
-					//Check North cell
-					FloodFill(row - 1, column);
-					//Check East cell
-					FloodFill(row, column + 1);
-					//Check South cell
-					FloodFill(row + 1, column);
-					//Check West cell
-					FloodFill(row, column - 1);
-				}
-			}
-		}
-	}
+	m_generation = generation;
 }
 
 /**********************************************************************
 * Purpose:
-*	To display the current state of the Board to the screen.
+*	To set the thread pool tiled generation and the adjacency counts
+*	of large boards run on.
 *
 * Precondition:
-*	<None>
+*	The pool to use (nullptr for the shared default pool). The pool
+*	must outlive the Board, or be replaced first. Other Boards, on
+*	other threads, may use the same pool at the same time.
 *
 * Postcondition:
-*	The current state of the Board is displayed to the screen.
+*	The pool is stored, not copied.
 **********************************************************************/
-void Board::DisplayBoard()
+void Board::SetThreadPool(ThreadPool * pool)
 {
-	system("cls");
-
-	//For each row on the board
-	for (int i = 0; i < m_arrayCells.getRow(); i++)
-	{
-		//For each column on the board
-		for (int j = 0; j < m_arrayCells.getColumn(); j++)
-		{
-			//If the cell is uncovered
-			if (m_arrayCells[i][j].GetState() == UNCOVERED)
-			{
-				//Display symbol for a mine
-				if (m_arrayCells[i][j].GetValue() == MINE)
-				{
-					SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 127);
-					cout << "# ";
-				}
-				//Display symbol for no adjacent mines
-				else if (m_arrayCells[i][j].GetValue() == NO_ADJ_MINES)
-				{
-					SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 112);
-					cout << "0 ";
-				}
-				//Display symbol for 1 adjacent mine
-				else if (m_arrayCells[i][j].GetValue() == ONE_ADJ_MINE)
-				{
-					SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 114);
-					cout << "1 ";
-				}
-				//Display symbol for 2 adjacent mine
-				else if (m_arrayCells[i][j].GetValue() == TWO_ADJ_MINES)
-				{
-					SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 126);
-					cout << "2 ";
-				}
-				//Display symbol for 3 adjacent mine
-				else if (m_arrayCells[i][j].GetValue() == THREE_ADJ_MINES)
-				{
-					SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 124);
-					cout << "3 ";
-				}
-				//Display symbol for 4 adjacent mine
-				else if (m_arrayCells[i][j].GetValue() == FOUR_ADJ_MINES)
-				{
-					SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 115);
-					cout << "4 ";
-				}
-				//Display symbol for 5 adjacent mine
-				else if (m_arrayCells[i][j].GetValue() == FIVE_ADJ_MINES)
-				{
-					SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 117);
-					cout << "5 ";
-				}
-				//Display symbol for 6 adjacent mine
-				else if (m_arrayCells[i][j].GetValue() == SIX_ADJ_MINES)
-				{
-					SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 121);
-					cout << "6 ";
-				}
-				//Display symbol for 7 adjacent mine
-				else if (m_arrayCells[i][j].GetValue() == SEVEN_ADJ_MINES)
-				{
-					SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 113);
-					cout << "7 ";
-				}
-				//Display symbol for 8 adjacent mine
-				else
-				{
-					SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 123);
-					cout << "8 ";
-				}
-			}
-			//Else if the cell is flagged
-			else if (m_arrayCells[i][j].GetState() == FLAGGED)
-			{
-				//Display symbol for flag
-				SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 125);
-				cout << "! ";
-			}
-			//Else the cell is covered
-			else
-			{
-				//Display "empty" covered spots
-				SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 120);
-				cout << "* ";
-			}
-
-			//Reset screen to default colors
-			SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 7);
-		}
-		//Move down a line on the screen
-		cout << "\n";
-	}
+	m_threadPool = pool;
 }
 
 /**********************************************************************
 * Purpose:
-*	To determine whether the user has won the game by either uncovering
-*	all cells that are not mines or by flagging all the mines (and no
-*	others).
+*	To uncover a cell on the board, unless the specified cell is
+*	already uncovered, has a flag, or is an invalid element. Illegal
+*	moves are reported in the result rather than thrown, so callers
+*	that make many moves (e.g. bots) pay nothing for them.
 *
 * Precondition:
-*	<None>
+*	Two integers specifying the row and column pair to uncover.
 *
 * Postcondition:
-*	A bool specifying whether the user won the game is returned.
+*	The specified cell is uncovered only if it is a valid cell to
+*	uncover. The result tells whether the move was illegal, hit a
+*	mine, or won the game, and how many cells were uncovered. Mines
+*	waiting for the first uncover are placed before it.
 **********************************************************************/
-bool Board::WonGame()
+MoveResult Board::TryUncover(int row, int column)
 {
-	bool wonGame = true;
-	int numFlags = 0;
-	int numMinesFlagged = 0;
+	MoveResult result = { MOVE_OK, 0 };
 
-	//Check if all cells are uncovered (other than ones with mines)
-	for (int i = 0; i < m_arrayCells.getRow(); i++)
+	//Deltas only describe the latest move
+	m_numDeltas = 0;
+
+	//If cell is out of bounds
+	if (!InBounds(row, column))
 	{
-		for (int j = 0; j < m_arrayCells.getColumn(); j++)
-		{
-			//If a non-mine cell is still covered
-			if (m_arrayCells[i][j].GetState() == COVERED && m_arrayCells[i][j].GetValue() != MINE)
-				wonGame = false;
+		result.status = MOVE_OUT_OF_BOUNDS;
+		return result;
+	}
 
-			//Else if a flagged cell is not a mine
-			else if (m_arrayCells[i][j].GetState() == FLAGGED && m_arrayCells[i][j].GetValue() != MINE)
-			{
-				numFlags++;
-				wonGame = false;
-			}
+	State state = GetCellState(row, column);
 
-			//If a flagged cell is a mine
-			if (m_arrayCells[i][j].GetState() == FLAGGED && m_arrayCells[i][j].GetValue() == MINE)
-			{
-				numFlags++;
-				numMinesFlagged++;
-			}
+	//First legal uncover places any deferred mines around itself
+	if (state == COVERED && !m_minesPlaced)
+		PlaceMines(row, column);
+
+	//If cell cannot be uncovered
+	if (state == UNCOVERED)
+		result.status = MOVE_ALREADY_UNCOVERED;
+	else if (state == FLAGGED)
+		result.status = MOVE_FLAGGED;
+	//Else if cell has a mine, game is lost
+	else if (HasMine(row, column))
+	{
+		SetCellState(row, column, UNCOVERED);
+		result.status = MOVE_HIT_MINE;
+		result.revealed = 1;
+	}
+	else
+	{
+		//If cell has no adjacent mines
+		if (EnsureCounted(row, column) == NO_ADJ_MINES)
+		{
+			result.revealed = RevealZeroRegion(row, column);
+		}
+		else
+		{
+			//Uncover cell
+			SetCellState(row, column, UNCOVERED);
+			result.revealed = 1;
 		}
+
+		if (WonGame())
+			result.status = MOVE_WON;
 	}
 
-	//If all mines are flagged (and no other cells are flagged)
-	if (numFlags == m_numMines && numMinesFlagged == m_numMines)
-		wonGame = true;
+	//Count legal moves so delta readers can tell if they missed one
+	if (result.status < MOVE_OUT_OF_BOUNDS)
+	{
+		m_moveNumber++;
+		m_lastMove.row = row;
+		m_lastMove.column = column;
+	}
 
-	return wonGame;
+	return result;
 }
 
 /**********************************************************************
 * Purpose:
-*	To reset the length of the array that contains the board data to
-*	zero so that it will deallocate before a new game begins.
+*	To add a flag to a cell on the board, unless the specified cell
+*	already has a flag, is uncovered, or is an invalid element.
+*	Illegal moves are reported in the result rather than thrown.
 *
 * Precondition:
-*	The board has data.
+*	Two integers specifying the row and column pair to add the flag to.
 *
 * Postcondition:
-*	The board has no size or data.
+*	A flag is added to the specified cell only if it is a valid cell
+*	to add a flag to. The result tells whether the move was illegal
+*	or won the game.
 **********************************************************************/
-void Board::ResetEmptyBoard()
+MoveResult Board::TryFlag(int row, int column)
 {
-	//Removes board data from array and resets length to zero
-	m_arrayCells.setRow(0);
-	m_arrayCells.setColumn(0);
+	MoveResult result = { MOVE_OK, 0 };
+
+	//Deltas only describe the latest move
+	m_numDeltas = 0;
+
+	//If cell is out of bounds
+	if (!InBounds(row, column))
+	{
+		result.status = MOVE_OUT_OF_BOUNDS;
+		return result;
+	}
+
+	State state = GetCellState(row, column);
+
+	//If cell cannot be flagged
+	if (state == UNCOVERED)
+		result.status = MOVE_ALREADY_UNCOVERED;
+	else if (state == FLAGGED)
+		result.status = MOVE_FLAGGED;
+	else
+	{
+		//Flag cell
+		SetCellState(row, column, FLAGGED);
+
+		if (WonGame())
+			result.status = MOVE_WON;
+	}
+
+	//Count legal moves so delta readers can tell if they missed one
+	if (result.status < MOVE_OUT_OF_BOUNDS)
+	{
+		m_moveNumber++;
+		m_lastMove.row = row;
+		m_lastMove.column = column;
+	}
+
+	return result;
 }
 
 /**********************************************************************
 * Purpose:
-*	To randomize the placement of the mines on the Board.
+*	To remove a flag from a cell on the board, unless the specified
+*	cell does not have a flag or is an invalid element. Illegal moves
+*	are reported in the result rather than thrown.
 *
 * Precondition:
-*	The Board starts with no mines.
+*	Two integers specifying the row and column pair to remove the flag
+*	from.
 *
 * Postcondition:
-*	The mines are randomly assigned to different cells on the Board.
-*	A call to the AssignCellValues() method is made.
+*	A flag is removed from the specified cell only if it is a valid
+*	cell to remove a flag from. The result tells whether the move was
+*	illegal or won the game.
 **********************************************************************/
-void Board::ShuffleMines()
+MoveResult Board::TryUnflag(int row, int column)
 {
-	int countMines = 0;		//Condition for while loop counting # of
-							//mines that have been assigned to board
+	MoveResult result = { MOVE_OK, 0 };
 
-	//Loop until all mines have been added
-	while (countMines < m_numMines)
+	//Deltas only describe the latest move
+	m_numDeltas = 0;
+
+	//If cell is out of bounds
+	if (!InBounds(row, column))
 	{
-		//Randomly choose a row and column to indicate a random cell
-		int cellRow = (rand() % (m_arrayCells.getRow()));
-		int cellCol = (rand() % (m_arrayCells.getColumn()));
+		result.status = MOVE_OUT_OF_BOUNDS;
+		return result;
+	}
 
-		//If randomly chosen cell does not contain a mine
-		if (m_arrayCells[cellRow][cellCol].GetValue() != MINE)
-		{
-			//Set value of cell to contain a mine
-			m_arrayCells[cellRow][cellCol].SetValue(MINE);
-			countMines++;
-		}
+	//If cell is flagged
+	if (GetCellState(row, column) == FLAGGED)
+	{
+		//Remove flag and reset to covered
+		SetCellState(row, column, COVERED);
+
+		if (WonGame())
+			result.status = MOVE_WON;
+	}
+	//Else cannot unflag cell
+	else
+		result.status = MOVE_NOT_FLAGGED;
+
+	//Count legal moves so delta readers can tell if they missed one
+	if (result.status < MOVE_OUT_OF_BOUNDS)
+	{
+		m_moveNumber++;
+		m_lastMove.row = row;
+		m_lastMove.column = column;
 	}
 
-	//Fill leftover cells with values for # of adjacent mines
-	AssignCellValues();
+	return result;
 }
 
 /**********************************************************************
 * Purpose:
-*	To increment the number of adjacent mines in each cell surrounding
-*	each cell with a mine.
+*	To allow the user to uncover a cell on the board, unless the
+*	specified cell is already uncovered, has a flag, or is an invalid
+*	element.
 *
 * Precondition:
-*	All non-mine cells start at zero adjacent cells.
+*	Two integers specifying the row and column pair to uncover.
 *
 * Postcondition:
-*	Each cell has a number specifying the number of adjacent mines to
-*	that particular cell.
+*	The specified cell is uncoverd only if it is a valid cell to
+*	uncover, and the result of the move is returned; else, an
+*	Exception is thrown.
 **********************************************************************/
-void Board::AssignCellValues()
+MoveResult Board::UncoverCell(int row, int column)
+{
+	MoveResult result = TryUncover(row, column);
+
+	//If cell is out of bounds, inform the user
+	if (result.status == MOVE_OUT_OF_BOUNDS)
+		throw Exception("ERROR: That cell is not part of the board.");
+	//Else if cannot uncover cell
+	else if (result.status > MOVE_OUT_OF_BOUNDS)
+		throw Exception("ERROR: Cannot uncover a cell that is already uncovered or flagged.");
+
+	return result;
+}
+
+/**********************************************************************
+* Purpose:
+*	To allow the user to add a flag to a cell on the board, unless
+*	the specified cell already has a flag, is uncovered, or is an
+*	invalid element.
+*
+* Precondition:
+*	Two integers specifying the row and column pair to add the flag to.
+*
+* Postcondition:
+*	A flag is added to the specified cell only if it is a valid cell
+*	to add a flag to, and the result of the move is returned; else,
+*	an Exception is thrown.
+**********************************************************************/
+MoveResult Board::FlagCell(int row, int column)
+{
+	MoveResult result = TryFlag(row, column);
+
+	//If cell is out of bounds, inform the user
+	if (result.status == MOVE_OUT_OF_BOUNDS)
+		throw Exception("ERROR: That cell is not part of the board.");
+	//Else if cannot flag cell
+	else if (result.status > MOVE_OUT_OF_BOUNDS)
+		throw Exception("ERROR: Cannot flag a cell that is already uncovered or flagged.");
+
+	return result;
+}
+
+/**********************************************************************
+* Purpose:
+*	To allow the user to remove a flag from a cell on the board, unless
+*	the specified cell does not have a flag or is an invalid element.
+*
+* Precondition:
+*	Two integers specifying the row and column pair to remove the flag
+*	from.
+*
+* Postcondition:
+*	A flag is removed from the specified cell only if it is a valid
+*	cell to remove a flag from, and the result of the move is
+*	returned; else, an Exception is thrown.
+**********************************************************************/
+MoveResult Board::RemoveFlaggedCell(int row, int column)
+{
+	MoveResult result = TryUnflag(row, column);
+
+	//If cell is out of bounds, inform the user
+	if (result.status == MOVE_OUT_OF_BOUNDS)
+		throw Exception("ERROR: That cell is not part of the board.");
+	//Else if cannot unflag cell
+	else if (result.status > MOVE_OUT_OF_BOUNDS)
+		throw Exception("ERROR: Cannot unflag a cell that is not already flagged.");
+
+	return result;
+}
+
+/**********************************************************************
+* Purpose:
+*	To determine whether a particular cell contains a mine.
+*
+* Precondition:
+*	Two integers specifying a row and column pair.
+*
+* Postcondition:
+*	A bool specifying whether the particular cell is a mine is
+*	returned.
+**********************************************************************/
+bool Board::IsMine(int row, int column)
+{
+	//If cell is out of bounds, inform the user & leave this method
+	if (!InBounds(row, column))
+		throw Exception("ERROR: That cell is not part of the board.");
+
+	return HasMine(row, column);
+}
+
+/**********************************************************************
+* Purpose:
+*	To uncover more cells upon uncovering a cell w/zero adjacent mines.
+*	Every cell around a cell w/zero adjacent mines (all 8 of them, as
+*	in the classic game) is uncovered, and the fill spreads through
+*	every connected cell w/zero adjacent mines. Flagged cells are left
+*	alone and stop the fill.
+*
+*	The fill works one horizontal span of zero cells at a time: a span
+*	is grown left & right from a seed, uncovered along w/the cell past
+*	each end, and then the rows above & below it are scanned, which
+*	uncovers their numbered cells and pushes one seed for each run of
+*	zero cells. Seeds go on a work stack the Board keeps between
+*	moves, so no region is too large and every cell is visited a
+*	constant number of times.
+*
+* Precondition:
+*	Two integers specifying the row and column pair of a covered cell
+*	w/zero adjacent mines.
+*
+* Postcondition:
+*	The cell and the region around it are uncovered, and the number
+*	of cells uncovered is returned.
+**********************************************************************/
+int Board::FloodFill(int row, int column)
 {
-	//Iterate through each row
-	for (int i = 0; i < m_arrayCells.getRow(); i++)
+	int revealed = 0;		//# cells uncovered
+	int numRows = GetRow();
+	int numColumns = GetColumn();
+	CellCoord seed = { row, column };
+
+	m_fillStack.Clear();
+	m_fillStack.Push(seed);
+
+	while (!m_fillStack.isEmpty())
 	{
-		//Iterate through each column
-		for (int j = 0; j < m_arrayCells.getColumn(); j++)
+		seed = m_fillStack.Pop();
+
+		//Seed may have been reached by another span since it was pushed
+		if (!IsCoveredZero(seed.row, seed.column))
+			continue;
+
+		//Grow span of zero cells left & right
+		int left = seed.column;
+		int right = seed.column;
+
+		while (left > 0 && IsCoveredZero(seed.row, left - 1))
+			left--;
+		while (right < numColumns - 1 && IsCoveredZero(seed.row, right + 1))
+			right++;
+
+		//Cells touching the span, one past each end
+		int first = (left > 0) ? left - 1 : 0;
+		int last = (right < numColumns - 1) ? right + 1 : numColumns - 1;
+
+		//Uncover span & its two end cells
+		for (int j = first; j <= last; j++)
 		{
-			//If cell contains a mine
-			if (m_arrayCells[i][j].GetValue() == MINE)
+			if (GetCellState(seed.row, j) == COVERED)
 			{
-				//Increment surrounding cells' # adjacent mines
-				//if not out of bounds & not containing a mine
+				SetCellState(seed.row, j, UNCOVERED);
+				revealed++;
+			}
+		}
 
-				//North cell
-				if ((i - 1) != -1 && m_arrayCells[i - 1][j].GetValue() != MINE)
-					m_arrayCells[i - 1][j].SetValue(static_cast<Value>(static_cast<int>(m_arrayCells[i - 1][j].GetValue()) + 1));
+		//Scan the rows above & below the span
+		for (int i = seed.row - 1; i <= seed.row + 1; i += 2)
+		{
+			if (i < 0 || i >= numRows)
+				continue;
 
-				//NorthEast cell
-				if ((i - 1) != -1 && (j + 1) != m_arrayCells.getColumn() && m_arrayCells[i - 1][j + 1].GetValue() != MINE)
-				{
-					m_arrayCells[i - 1][j + 1].SetValue(static_cast<Value>(static_cast<int>(m_arrayCells[i - 1][j + 1].GetValue()) + 1));
-				}
+			bool inRun = false;		//Whether last cell was a covered zero
 
-				//East cell
-				if ((j + 1) != m_arrayCells.getColumn() && m_arrayCells[i][j + 1].GetValue() != MINE)
+			for (int j = first; j <= last; j++)
+			{
+				//Uncovered & flagged cells end a run
+				if (GetCellState(i, j) != COVERED)
+					inRun = false;
+				//One seed per run of zero cells
+				else if (EnsureCounted(i, j) == NO_ADJ_MINES)
 				{
-					m_arrayCells[i][j + 1].SetValue(static_cast<Value>(static_cast<int>(m_arrayCells[i][j + 1].GetValue()) + 1));
+					if (!inRun)
+					{
+						CellCoord next = { i, j };
+						m_fillStack.Push(next);
+						inRun = true;
+					}
 				}
-
-				//SouthEast cell
-				if ((i + 1) != m_arrayCells.getRow() && (j + 1) != m_arrayCells.getColumn() && m_arrayCells[i + 1][j + 1].GetValue() != MINE)
+				//Numbered cell next to the span (never a mine)
+				else
 				{
-					m_arrayCells[i + 1][j + 1].SetValue(static_cast<Value>(static_cast<int>(m_arrayCells[i + 1][j + 1].GetValue()) + 1));
+					SetCellState(i, j, UNCOVERED);
+					revealed++;
+					inRun = false;
 				}
+			}
+		}
+	}
 
-				//South cell
-				if ((i + 1) != m_arrayCells.getRow() && m_arrayCells[i + 1][j].GetValue() != MINE)
-				{
-					m_arrayCells[i + 1][j].SetValue(static_cast<Value>(static_cast<int>(m_arrayCells[i + 1][j].GetValue()) + 1));
-				}
+	return revealed;
+}
 
-				//SouthWest cell
-				if ((i + 1) != m_arrayCells.getRow() && (j - 1) != -1 && m_arrayCells[i + 1][j - 1].GetValue() != MINE)
-				{
-					m_arrayCells[i + 1][j - 1].SetValue(static_cast<Value>(static_cast<int>(m_arrayCells[i + 1][j - 1].GetValue()) + 1));
-				}
+/**********************************************************************
+* Purpose:
+*	To determine whether a cell is still covered and has zero adjacent
+*	mines, i.e. whether the flood fill can spread into it.
+*
+* Precondition:
+*	Two integers specifying a row and column pair on the board.
+*
+* Postcondition:
+*	True is returned if the cell is covered (not flagged) and has no
+*	adjacent mines.
+**********************************************************************/
+bool Board::IsCoveredZero(int row, int column)
+{
+	return GetCellState(row, column) == COVERED && EnsureCounted(row, column) == NO_ADJ_MINES;
+}
+
+/**********************************************************************
+* Purpose:
+*	To get the value of a cell for a move, storing the count of a
+*	lazily counted cell so later reads (and renders) find it. Only
+*	the move methods write counts; GetCellValue() never does.
+*
+* Precondition:
+*	Two integers specifying a row and column pair on the board.
+*
+* Postcondition:
+*	The value of the cell is returned, and stored in the cell if it
+*	wasn't yet.
+**********************************************************************/
+Value Board::EnsureCounted(int row, int column)
+{
+	if (m_backend != CELL_BACKEND)
+		return GetCellValue(row, column);
+
+	//Until the mines are placed, every cell reads as zero & nothing
+	//is stored
+	Cell & cell = m_arrayCells.RawRow(row)[column];
+
+	if (m_minesPlaced && !cell.IsCounted() && cell.GetValue() != MINE)
+	{
+		cell.SetValue(CountCellValue(row, column));
+		cell.SetCounted();
+	}
+
+	return cell.GetValue();
+}
+
+/**********************************************************************
+* Purpose:
+*	To uncover the region around a cell w/zero adjacent mines. On
+*	large boards the zero-region index is built on the first call, and
+*	after that a region none of whose zero cells were flagged or
+*	uncovered is uncovered by walking its list of cells.
+*
+* Precondition:
+*	Two integers specifying the row and column pair of a covered cell
+*	w/zero adjacent mines.
+*
+* Postcondition:
+*	The cell and the region around it are uncovered, and the number
+*	of cells uncovered is returned.
+**********************************************************************/
+int Board::RevealZeroRegion(int row, int column)
+{
+	//Small boards, boards w/o the index, & sparse boards (whose mines
+	//take less memory than the index would) just flood fill
+	if (!m_useRegionIndex || m_backend == SPARSE_BACKEND ||
+		GetRow() * GetColumn() < REGION_INDEX_MIN_CELLS)
+		return FloodFill(row, column);
+
+	//Index is built lazily on the first zero reveal
+	if (!m_regionIndexBuilt)
+		BuildRegionIndex();
+
+	int numColumns = GetColumn();
+	int region = m_regionIds(row * numColumns + column);
+	int first = m_regionStarts(region);
+	int last = m_regionStarts(region + 1);
+
+	//Once a zero cell of the region was flagged or uncovered, a flood
+	//fill stops at it & may not reach the whole list, so let FloodFill
+	//handle it
+	if (m_regionTouched(region))
+		return FloodFill(row, column);
+
+	//Debug builds make the same move on a copy w/o the index
+#ifdef _DEBUG
+	Board floodFilled(*this);
+	floodFilled.UseRegionIndex(false);
+	int floodRevealed = floodFilled.FloodFill(row, column);
+#endif
+
+	int revealed = 0;	//# cells uncovered
+
+	//Uncover every covered cell of the region & its border
+	for (int k = first; k < last; k++)
+	{
+		int cell = m_regionCells(k);
+		int i = cell / numColumns;
+		int j = cell % numColumns;
+
+		if (GetCellState(i, j) == COVERED)
+		{
+			SetCellState(i, j, UNCOVERED);
+			revealed++;
+		}
+	}
+
+	//The walk must uncover exactly what the flood fill did
+#ifdef _DEBUG
+	assert(revealed == floodRevealed && StatesMatch(floodFilled));
+#endif
+
+	return revealed;
+}
+
+/**********************************************************************
+* Purpose:
+*	To build the zero-region index. Zero cells are labeled in one pass
+*	over the board, joining each to the zero cells above & to its left
+*	(8-way) w/union-find, and a second pass gives every region a
+*	compact id. The cells of each region, followed by the numbered
+*	cells on its border, are then listed together in m_regionCells,
+*	w/m_regionStarts marking where each region's list begins.
+*
+* Precondition:
+*	The board holds its mines.
+*
+* Postcondition:
+*	m_regionIds, m_regionStarts, and m_regionCells describe every zero
+*	region, m_regionTouched marks the regions w/a zero cell that isn't
+*	covered, and the index is marked as built.
+**********************************************************************/
+void Board::BuildRegionIndex()
+{
+	int numRows = GetRow();
+	int numColumns = GetColumn();
+	int stride = numColumns + 2;	//Padded row width of m_minePlane
+
+	m_numRegions = 0;
+	m_regionIndexBuilt = true;
 
-				//West cell
-				if ((j - 1) != -1 && m_arrayCells[i][j - 1].GetValue() != MINE)
+	//Nothing to label on an empty board
+	if (numRows == 0 || numColumns == 0)
+	{
+		m_regionStarts.Resize(1);
+		m_regionCells.Resize(0);
+		m_regionTouched.Resize(0);
+		return;
+	}
+
+	CountMines();
+
+	Array<int> & ids = m_regionIds;
+	//A new label is only needed where the cell to the left is not a
+	//zero cell, so at most every other cell of a row starts one
+	Array<int> & parent = m_regionStarts;
+	int numLabels = 0;
+
+	ids.Resize(numRows * numColumns);
+	parent.Resize(numRows * ((numColumns + 1) / 2));
+
+	//First pass: provisional labels joined w/union-find
+	for (int i = 0; i < numRows; i++)
+	{
+		const uint8_t * mineRow = &m_minePlane((i + 1) * stride + 1);
+		const uint8_t * countRow = &m_mineCounts(i * numColumns);
+
+		for (int j = 0; j < numColumns; j++)
+		{
+			int cell = i * numColumns + j;
+
+			//Only zero cells get labels
+			if (mineRow[j] != 0 || countRow[j] != 0)
+			{
+				ids(cell) = -1;
+				continue;
+			}
+
+			int label = -1;		//Smallest root among labeled neighbors
+
+			//Neighbors already visited: W, NW, N, NE
+			int neighbors[4];
+			int numNeighbors = 0;
+
+			if (j > 0)
+				neighbors[numNeighbors++] = ids(cell - 1);
+			if (i > 0)
+			{
+				if (j > 0)
+					neighbors[numNeighbors++] = ids(cell - numColumns - 1);
+				neighbors[numNeighbors++] = ids(cell - numColumns);
+				if (j < numColumns - 1)
+					neighbors[numNeighbors++] = ids(cell - numColumns + 1);
+			}
+
+			for (int k = 0; k < numNeighbors; k++)
+			{
+				if (neighbors[k] < 0)
+					continue;
+
+				//Find root, halving the path on the way
+				int root = neighbors[k];
+				while (parent(root) != root)
 				{
-					m_arrayCells[i][j - 1].SetValue(static_cast<Value>(static_cast<int>(m_arrayCells[i][j - 1].GetValue()) + 1));
+					parent(root) = parent(parent(root));
+					root = parent(root);
 				}
 
-				//NorthWest cell
-				if ((i - 1) != -1 && (j - 1) != -1 && m_arrayCells[i - 1][j - 1].GetValue() != MINE)
+				//Join the two sets under the smaller root
+				if (label < 0)
+					label = root;
+				else if (root < label)
 				{
-					m_arrayCells[i - 1][j - 1].SetValue(static_cast<Value>(static_cast<int>(m_arrayCells[i - 1][j - 1].GetValue()) + 1));
+					parent(label) = root;
+					label = root;
 				}
+				else if (root > label)
+					parent(root) = label;
+			}
+
+			//No labeled neighbors, so start a new label
+			if (label < 0)
+			{
+				label = numLabels++;
+				parent(label) = label;
+			}
+
+			ids(cell) = label;
+		}
+	}
+
+	//Second pass: roots get compact ids, stored as -(id + 1) so they
+	//can't be mistaken for labels. Every label's parent is smaller than
+	//it, so its root has already been given an id.
+	for (int label = 0; label < numLabels; label++)
+	{
+		if (parent(label) == label)
+			parent(label) = -(m_numRegions++ + 1);
+		else
+			parent(label) = parent(parent(label));
+	}
+
+	for (int cell = 0; cell < numRows * numColumns; cell++)
+	{
+		if (ids(cell) >= 0)
+			ids(cell) = -parent(ids(cell)) - 1;
+	}
+
+	//Count the cells of each region & its border
+	Array<int> & starts = m_regionStarts;
+	int regions[8];		//Regions bordering a numbered cell
+
+	starts.Resize(m_numRegions + 1);
+	m_regionTouched.Resize(m_numRegions);
+
+	for (int i = 0; i < numRows; i++)
+	{
+		for (int j = 0; j < numColumns; j++)
+		{
+			int cell = i * numColumns + j;
+
+			if (ids(cell) >= 0)
+			{
+				starts(ids(cell) + 1)++;
+
+				//Cells flagged or uncovered before the index was built
+				if (GetCellState(i, j) != COVERED)
+					m_regionTouched(ids(cell)) = true;
+			}
+			else if (m_minePlane((i + 1) * stride + j + 1) == 0)
+			{
+				int numBorders = GetBorderRegions(i, j, regions);
+				for (int k = 0; k < numBorders; k++)
+					starts(regions[k] + 1)++;
+			}
+		}
+	}
+
+	for (int region = 0; region < m_numRegions; region++)
+		starts(region + 1) += starts(region);
+
+	//List the cells, using starts as each region's write position
+	m_regionCells.Resize(starts(m_numRegions));
+
+	for (int i = 0; i < numRows; i++)
+	{
+		for (int j = 0; j < numColumns; j++)
+		{
+			int cell = i * numColumns + j;
+
+			if (ids(cell) >= 0)
+				m_regionCells(starts(ids(cell))++) = cell;
+			else if (m_minePlane((i + 1) * stride + j + 1) == 0)
+			{
+				int numBorders = GetBorderRegions(i, j, regions);
+				for (int k = 0; k < numBorders; k++)
+					m_regionCells(starts(regions[k])++) = cell;
 			}
 		}
 	}
+
+	//Each write position ended at the start of the next region
+	for (int region = m_numRegions; region > 0; region--)
+		starts(region) = starts(region - 1);
+	starts(0) = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To find the distinct zero regions around a cell that is not a
+*	zero cell.
+*
+* Precondition:
+*	Two integers specifying a row and column pair on the board, and an
+*	array of at least 8 ints. m_regionIds holds final region ids.
+*
+* Postcondition:
+*	The distinct region ids are stored in the array, and their number
+*	is returned.
+**********************************************************************/
+int Board::GetBorderRegions(int row, int column, int * regions) const
+{
+	int numRows = GetRow();
+	int numColumns = GetColumn();
+	int numRegions = 0;
+
+	for (int i = row - 1; i <= row + 1; i++)
+	{
+		for (int j = column - 1; j <= column + 1; j++)
+		{
+			if (i < 0 || i >= numRows || j < 0 || j >= numColumns)
+				continue;
+
+			int region = m_regionIds(i * numColumns + j);
+			if (region < 0)
+				continue;
+
+			//Keep each region once
+			bool found = false;
+			for (int k = 0; k < numRegions && !found; k++)
+				found = (regions[k] == region);
+
+			if (!found)
+				regions[numRegions++] = region;
+		}
+	}
+
+	return numRegions;
+}
+
+/**********************************************************************
+* Purpose:
+*	To determine whether the user has won the game by either uncovering
+*	all cells that are not mines or by flagging all the mines (and no
+*	others). The running counters answer this w/o scanning the board.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	A bool specifying whether the user won the game is returned.
+**********************************************************************/
+bool Board::WonGame()
+{
+	//Debug builds check the counters against a full rescan
+#ifdef _DEBUG
+	assert(CountersMatchBoard());
+#endif
+
+	//Won if all non-mine cells are uncovered, or if all mines are
+	//flagged (and no other cells are flagged)
+	return m_numCoveredSafe == 0 ||
+		(m_numFlags == m_numMines && m_numMinesFlagged == m_numMines);
 }
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the number of mines not yet flagged, as shown to the
+*	user. Flagging cells that aren't mines can make it negative.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The # mines minus the # flags is returned.
+**********************************************************************/
+int Board::GetMinesRemaining() const
+{
+	return m_numMines - m_numFlags;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the number of cells w/o mines that still need to be
+*	uncovered.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The # covered or flagged cells w/o mines is returned.
+**********************************************************************/
+int Board::GetCellsLeft() const
+{
+	return m_numCoveredSafe;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the cells the latest move changed, in the order it
+*	changed them. The pointer refers to the Board's own buffer, which
+*	the next move overwrites, so nothing is copied.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	A pointer to the first of GetDeltaCount() deltas is returned.
+**********************************************************************/
+const CellDelta * Board::GetDeltas() const
+{
+	return (m_numDeltas > 0) ? &m_deltas(0) : nullptr;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the number of cells the latest move changed.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The # deltas is returned; zero after an illegal move.
+**********************************************************************/
+int Board::GetDeltaCount() const
+{
+	return m_numDeltas;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the number of legal moves made since the board was
+*	created. A delta reader that sees this jump by more than one has
+*	missed a move's deltas and must rescan the board instead.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The # legal moves is returned.
+**********************************************************************/
+unsigned int Board::GetMoveNumber() const
+{
+	return m_moveNumber;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the cell the latest legal move was made on, e.g. so a
+*	view of part of the board can follow play.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The row and column of the latest legal move are returned; (0, 0)
+*	if no legal move was made yet.
+**********************************************************************/
+CellCoord Board::GetLastMove() const
+{
+	return m_lastMove;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the seed the mines were placed from, so the same
+*	board can be made again.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The seed given to (or made by) CreateBoard() is returned.
+**********************************************************************/
+uint64_t Board::GetSeed() const
+{
+	return m_seed;
+}
+
+/**********************************************************************
+* Purpose:
+*	To check every cell state against another board. RevealZeroRegion()
+*	calls this in debug builds, so a list walk that uncovers anything
+*	a flood fill wouldn't is caught on the move that does it.
+*
+* Precondition:
+*	A board of the same size.
+*
+* Postcondition:
+*	True is returned if every cell has the same state on both boards.
+**********************************************************************/
+bool Board::StatesMatch(const Board & other) const
+{
+	if (GetRow() != other.GetRow() || GetColumn() != other.GetColumn())
+		return false;
+
+	for (int i = 0; i < GetRow(); i++)
+	{
+		for (int j = 0; j < GetColumn(); j++)
+		{
+			if (GetCellState(i, j) != other.GetCellState(i, j))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+/**********************************************************************
+* Purpose:
+*	To check the running counters against a full scan of the board.
+*	WonGame() calls this in debug builds.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	True is returned if every counter matches the board.
+**********************************************************************/
+bool Board::CountersMatchBoard() const
+{
+	int numCoveredSafe = 0;
+	int numFlags = 0;
+	int numMinesFlagged = 0;
+
+	for (int i = 0; i < GetRow(); i++)
+	{
+		for (int j = 0; j < GetColumn(); j++)
+		{
+			State state = GetCellState(i, j);
+			bool mine = HasMine(i, j);
+
+			//If a non-mine cell is still covered (or flagged)
+			if (!mine && state != UNCOVERED)
+				numCoveredSafe++;
+
+			//If a cell is flagged
+			if (state == FLAGGED)
+			{
+				numFlags++;
+
+				if (mine)
+					numMinesFlagged++;
+			}
+		}
+	}
+
+	//Mines still to be placed are counted as covered
+	if (!m_minesPlaced)
+		numCoveredSafe -= m_numMines;
+
+	return numCoveredSafe == m_numCoveredSafe && numFlags == m_numFlags &&
+		numMinesFlagged == m_numMinesFlagged;
+}
+
+/**********************************************************************
+* Purpose:
+*	To reset the size of the arrays that contain the board data to
+*	zero before a new game begins. Their storage is kept, so the next
+*	CreateBoard() of the same (or a smaller) size does not allocate.
+*
+* Precondition:
+*	The board has data.
+*
+* Postcondition:
+*	The board has no size or data.
+**********************************************************************/
+void Board::ResetEmptyBoard()
+{
+	//Removes board data from array and resets size to zero
+	m_arrayCells.Reset();
+
+	//Removes board data from the bit planes
+	m_mines.Resize(0, 0);
+	m_mineSet.Clear();
+	m_uncovered.Resize(0, 0);
+	m_flagged.Resize(0, 0);
+
+	//Zero-region index no longer matches the mines
+	m_regionIndexBuilt = false;
+	m_numRegions = 0;
+
+	m_numCoveredSafe = 0;
+	m_numFlags = 0;
+	m_numMinesFlagged = 0;
+
+	//Delta buffer keeps its storage for the next game
+	m_numDeltas = 0;
+	m_moveNumber = 0;
+	m_lastMove = CellCoord();
+	m_minesPlaced = false;
+}
+
+/**********************************************************************
+* Purpose:
+*	To turn the zero-region index on or off. With it off, every zero
+*	reveal flood fills.
+*
+* Precondition:
+*	A bool specifying whether zero reveals may use the index.
+*
+* Postcondition:
+*	The setting is stored.
+**********************************************************************/
+void Board::UseRegionIndex(bool use)
+{
+	m_useRegionIndex = use;
+}
+
+/**********************************************************************
+* Purpose:
+*	To choose whether the next CreateBoard() counts the adjacent mines
+*	of every cell up front, or leaves each count until the cell is
+*	read. Counting lazily makes creating a huge board, most of which
+*	is never uncovered, cost only the mine placement.
+*
+* Precondition:
+*	Whether the counts are to be made lazily.
+*
+* Postcondition:
+*	The setting is stored for the boards CreateBoard() makes.
+**********************************************************************/
+void Board::UseLazyValues(bool use)
+{
+	m_useLazyValues = use;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the number of connected regions of cells w/zero
+*	adjacent mines, e.g. for rating how hard a board is.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The zero-region index is built if it wasn't already, and its
+*	number of regions is returned.
+**********************************************************************/
+int Board::GetZeroRegionCount()
+{
+	if (!m_regionIndexBuilt)
+		BuildRegionIndex();
+
+	return m_numRegions;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the number of rows on the Board.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of rows is returned.
+**********************************************************************/
+int Board::GetRow() const
+{
+	return (m_backend == CELL_BACKEND) ? m_arrayCells.getRow() : m_uncovered.getRow();
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the number of columns on the Board.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of columns is returned.
+**********************************************************************/
+int Board::GetColumn() const
+{
+	return (m_backend == CELL_BACKEND) ? m_arrayCells.getColumn() : m_uncovered.getColumn();
+}
+
+/**********************************************************************
+* Purpose:
+*	To place the mines CreateBoard() left for the first uncover, none
+*	of them on the uncovered cell or, w/FIRST_CLICK_OPENING, on its
+*	neighbors. If the board has too many mines to keep them all off
+*	the neighbors, only the cell itself is kept clear; if every cell
+*	is a mine, none is.
+*
+* Precondition:
+*	Two integers specifying the row and column pair of the first cell
+*	uncovered, which is on the board. No mines are placed yet.
+*
+* Postcondition:
+*	The mines are placed, the count of flagged mines matches them,
+*	and the zero-region index will be rebuilt for them.
+**********************************************************************/
+void Board::PlaceMines(int row, int column)
+{
+	int numRows = GetRow();
+	int numCols = GetColumn();
+	int64_t excluded[9];	//Cells kept clear, in increasing order
+	int numExcluded = 0;
+
+	//Keep the 3x3 area around the cell clear if the mines still fit
+	if (m_firstClick == FIRST_CLICK_OPENING)
+	{
+		for (int i = row - 1; i <= row + 1; i++)
+		{
+			for (int j = column - 1; j <= column + 1; j++)
+			{
+				if (i >= 0 && i < numRows && j >= 0 && j < numCols)
+					excluded[numExcluded++] = static_cast<int64_t>(i) * numCols + j;
+			}
+		}
+
+		if (m_numMines > static_cast<int64_t>(numRows) * numCols - numExcluded)
+			numExcluded = 0;
+	}
+
+	//Else keep just the cell clear if the mines still fit
+	if (numExcluded == 0 && m_numMines < static_cast<int64_t>(numRows) * numCols)
+		excluded[numExcluded++] = static_cast<int64_t>(row) * numCols + column;
+
+	if (m_generation == GENERATE_TILED && m_backend != SPARSE_BACKEND)
+		TileMines(excluded, numExcluded);
+	else
+		ShuffleMines(excluded, numExcluded);
+
+	m_minesPlaced = true;
+
+	//Flags placed before the mines may be on some of them now
+	m_numMinesFlagged = 0;
+
+	for (int i = 0; i < numRows && m_numMinesFlagged < m_numFlags; i++)
+	{
+		for (int j = 0; j < numCols; j++)
+		{
+			if (GetCellState(i, j) == FLAGGED && HasMine(i, j))
+				m_numMinesFlagged++;
+		}
+	}
+
+	//Zero-region index was built (if at all) w/o the mines
+	m_regionIndexBuilt = false;
+}
+
+/**********************************************************************
+* Purpose:
+*	To randomize the placement of the mines on the Board, using
+*	Floyd's algorithm: for each of the last m_numMines cell indexes j,
+*	draw a cell in [0, j] and place a mine there, or at j itself if
+*	the drawn cell already has one. Every set of mine cells is equally
+*	likely, and it takes exactly one draw per mine at any density,
+*	unlike retrying random cells until an empty one turns up.
+*	Excluded cells are left out of the indexes, so keeping them clear
+*	costs no extra draws either.
+*
+* Precondition:
+*	The Board starts with no mines, m_seed holds the seed, and there
+*	are at least m_numMines cells that aren't excluded. The excluded
+*	cells (row * # columns + column) are in increasing order.
+*
+* Postcondition:
+*	The mines are randomly assigned to different cells on the Board,
+*	none of them excluded. A call to the AssignCellValues() method is
+*	made. An Exception is thrown if the mines don't fit.
+**********************************************************************/
+void Board::ShuffleMines(const int64_t * excluded, int numExcluded)
+{
+	int numCols = GetColumn();
+	int numCandidates = GetRow() * numCols - numExcluded;
+	Xoshiro256 random(m_seed);
+
+	//If the mines don't fit, j would start below zero
+	if (m_numMines < 0 || m_numMines > numCandidates)
+		throw Exception("ERROR: Not enough cells for the mines.");
+
+	for (int j = numCandidates - m_numMines; j < numCandidates; j++)
+	{
+		int index = static_cast<int>(random.NextBelow(static_cast<uint32_t>(j) + 1));
+		int cell = static_cast<int>(SkipExcluded(index, excluded, numExcluded));
+
+		//If drawn cell has a mine, cell j can't have one yet
+		if (HasMine(cell / numCols, cell % numCols))
+			cell = static_cast<int>(SkipExcluded(j, excluded, numExcluded));
+
+		SetMine(cell / numCols, cell % numCols);
+	}
+
+	//Fill leftover cells with values for # of adjacent mines
+	//(BitPlanes, CellSets, & lazy Cells count adjacent mines when a
+	//value is asked for)
+	if (m_backend == CELL_BACKEND && !m_useLazyValues)
+		AssignCellValues();
+}
+
+/**********************************************************************
+* Purpose:
+*	To place the mines tile by tile on the thread pool. Each cell that
+*	isn't excluded is a mine if its Philox4x32 output falls below the
+*	mine density, so each tile depends only on the seed & where the
+*	tile is. The tiles then hold a binomially distributed # of mines;
+*	Floyd's algorithm picks which of the mines (or of the empty cells)
+*	to take out (or fill) to make the count exact, by rank in tile
+*	order, and the tiles holding those ranks fix themselves in
+*	parallel. Taking a uniform subset of a uniform placement keeps
+*	every placement equally likely. Drawn ranks are found in a hash
+*	set & sorted once, so k changes cost O(k log k), and ranks & cells
+*	are 64-bit, so boards may have more than 2^31 cells.
+*
+* Precondition:
+*	The Board starts with no mines, m_seed holds the seed, and there
+*	are at least m_numMines cells that aren't excluded. The excluded
+*	cells (row * # columns + column) are in increasing order.
+*
+* Postcondition:
+*	Exactly m_numMines mines are assigned to different cells on the
+*	Board, none of them excluded, the same for any # of threads. A
+*	call to the AssignCellValues() method is made. An Exception is
+*	thrown if the mines don't fit.
+**********************************************************************/
+void Board::TileMines(const int64_t * excluded, int numExcluded)
+{
+	int numRows = GetRow();
+	int numCols = GetColumn();
+	int numTileCols = (numCols + MINE_TILE_SIZE - 1) / MINE_TILE_SIZE;
+	int numTiles = (numRows + MINE_TILE_SIZE - 1) / MINE_TILE_SIZE * numTileCols;
+	int64_t numCandidates = static_cast<int64_t>(numRows) * numCols - numExcluded;
+	ThreadPool * pool = GetThreadPool();
+	Philox4x32 tileRandom(m_seed);
+
+	//If the mines don't fit, the fix-up could never find enough cells
+	if (m_numMines < 0 || m_numMines > numCandidates)
+		throw Exception("ERROR: Not enough cells for the mines.");
+
+	//Nothing to place on an empty board
+	if (numTiles == 0)
+		return;
+
+	//Chance of a mine in each cell, as a fraction of 2^32
+	uint64_t threshold = (numCandidates > 0) ?
+		(static_cast<uint64_t>(m_numMines) << 32) / static_cast<uint64_t>(numCandidates) : 0;
+
+	Array<int> tileMines(numTiles);			//# mines in each tile
+	Array<int> tileEmpty(numTiles);			//# empty cells that may get a mine
+	Array<int> tileFirstRank(numTiles + 1);	//First fix-up rank in each tile
+	Array<int64_t> tilePoolStart(numTiles);	//Rank of each tile's first pool cell
+
+	//Make every tile's mines, counting them
+	pool->Run(numTiles, [&](int tile)
+	{
+		int tileRow = tile / numTileCols;
+		int tileCol = tile % numTileCols;
+		int firstRow = tileRow * MINE_TILE_SIZE;
+		int firstCol = tileCol * MINE_TILE_SIZE;
+		int endRow = std::min(firstRow + MINE_TILE_SIZE, numRows);
+		int endCol = std::min(firstCol + MINE_TILE_SIZE, numCols);
+		uint64_t tileCounter = (static_cast<uint64_t>(tileRow) << 32) | static_cast<uint32_t>(tileCol);
+		uint32_t random[4];
+		int mines = 0;
+		int empty = 0;
+
+		//Only check tiles holding excluded cells for them
+		int tileExcluded = 0;
+
+		for (int k = 0; k < numExcluded; k++)
+		{
+			if (excluded[k] / numCols / MINE_TILE_SIZE == tileRow &&
+				excluded[k] % numCols / MINE_TILE_SIZE == tileCol)
+				tileExcluded = numExcluded;
+		}
+
+		for (int i = firstRow; i < endRow; i++)
+		{
+			for (int j = firstCol; j < endCol; j++)
+			{
+				int local = (i - firstRow) * MINE_TILE_SIZE + (j - firstCol);
+
+				//Each counter gives the numbers for four cells
+				if ((local & 3) == 0)
+					tileRandom.Generate(static_cast<uint64_t>(local / 4), tileCounter, random);
+
+				if (IsExcluded(static_cast<int64_t>(i) * numCols + j, excluded, tileExcluded))
+					continue;
+
+				if (random[local & 3] < threshold)
+				{
+					SetMine(i, j);
+					mines++;
+				}
+				else
+					empty++;
+			}
+		}
+
+		tileMines(tile) = mines;
+		tileEmpty(tile) = empty;
+	});
+
+	int64_t numTileMines = 0;
+
+	for (int t = 0; t < numTiles; t++)
+		numTileMines += tileMines(t);
+
+	//Take out or add the mines the tiles made too many or too few
+	bool removing = numTileMines > m_numMines;
+	int numChanges = static_cast<int>(removing ? numTileMines - m_numMines : m_numMines - numTileMines);
+
+	if (numChanges > 0)
+	{
+		const Array<int> & tilePool = removing ? tileMines : tileEmpty;
+		int64_t poolSize = removing ? numTileMines : numCandidates - numTileMines;
+		Array<int64_t> ranks(numChanges);	//Ranks to change, in increasing order
+		std::unordered_set<int64_t> drawn;	//Ranks drawn so far
+		int numRanks = 0;
+		Xoshiro256 random(m_seed);
+
+		//Floyd's algorithm, w/a hash set to find ranks already drawn
+		drawn.reserve(numChanges);
+
+		for (int64_t j = poolSize - numChanges; j < poolSize; j++)
+		{
+			int64_t rank = static_cast<int64_t>(random.NextBelow64(static_cast<uint64_t>(j) + 1));
+
+			//If drawn rank is taken, rank j can't be yet
+			if (!drawn.insert(rank).second)
+			{
+				rank = j;
+				drawn.insert(rank);
+			}
+
+			ranks(numRanks++) = rank;
+		}
+
+		//Tiles take their ranks in increasing order
+		std::sort(&ranks(0), &ranks(0) + numRanks);
+
+		//Find where each tile's ranks start
+		int64_t poolStart = 0;
+		int firstRank = 0;
+
+		for (int t = 0; t < numTiles; t++)
+		{
+			tileFirstRank(t) = firstRank;
+			tilePoolStart(t) = poolStart;
+			poolStart += tilePool(t);
+
+			while (firstRank < numChanges && ranks(firstRank) < poolStart)
+				firstRank++;
+		}
+
+		tileFirstRank(numTiles) = numChanges;
+
+		//Each tile changes the cells holding its ranks
+		pool->Run(numTiles, [&](int tile)
+		{
+			int next = tileFirstRank(tile);
+			int last = tileFirstRank(tile + 1);
+			int64_t rank = tilePoolStart(tile);
+			int firstRow = tile / numTileCols * MINE_TILE_SIZE;
+			int firstCol = tile % numTileCols * MINE_TILE_SIZE;
+			int endRow = std::min(firstRow + MINE_TILE_SIZE, numRows);
+			int endCol = std::min(firstCol + MINE_TILE_SIZE, numCols);
+
+			for (int i = firstRow; i < endRow && next < last; i++)
+			{
+				for (int j = firstCol; j < endCol && next < last; j++)
+				{
+					bool mine = HasMine(i, j);
+
+					//If cell isn't in the pool of cells to pick from
+					if (mine != removing ||
+						(!mine && IsExcluded(static_cast<int64_t>(i) * numCols + j, excluded, numExcluded)))
+						continue;
+
+					if (rank++ == ranks(next))
+					{
+						if (removing)
+							ClearMine(i, j);
+						else
+							SetMine(i, j);
+
+						next++;
+					}
+				}
+			}
+		});
+	}
+
+	//Fill leftover cells with values for # of adjacent mines
+	//(BitPlanes, CellSets, & lazy Cells count adjacent mines when a
+	//value is asked for)
+	if (m_backend == CELL_BACKEND && !m_useLazyValues)
+		AssignCellValues();
+}
+
+/**********************************************************************
+* Purpose:
+*	To set the number of adjacent mines of each cell that doesn't
+*	contain a mine, from the counts CountMines() makes. Large boards
+*	store the counts one band of rows per task on the thread pool.
+*
+* Precondition:
+*	All non-mine cells start at zero adjacent cells.
+*
+* Postcondition:
+*	Each cell has a number specifying the number of adjacent mines to
+*	that particular cell.
+**********************************************************************/
+void Board::AssignCellValues()
+{
+	int numRows = m_arrayCells.getRow();
+	int numCols = m_arrayCells.getColumn();
+
+	//Nothing to count on an empty board
+	if (numRows == 0 || numCols == 0)
+		return;
+
+	CountMines();
+
+	int numBands = CountBands();
+
+	//Store each count in its cell, leaving the mines alone
+	RunBands(numBands, [&](int firstRow, int endRow)
+	{
+		for (int i = firstRow; i < endRow; i++)
+		{
+			Cell * cellRow = m_arrayCells.RawRow(i);
+			const uint8_t * countRow = &m_mineCounts(i * numCols);
+
+			for (int j = 0; j < numCols; j++)
+			{
+				if (cellRow[j].GetValue() != MINE)
+				{
+					cellRow[j].SetValue(static_cast<Value>(countRow[j]));
+					cellRow[j].SetCounted();
+				}
+			}
+		}
+	});
+}
+
+/**********************************************************************
+* Purpose:
+*	To count the mines around one cell of a CELL_BACKEND board. The
+*	padding ring lets the cells on the edges be counted w/o edge
+*	checks.
+*
+* Precondition:
+*	Two integers specifying a row and column pair on the Board.
+*
+* Postcondition:
+*	The number of mines in the 8 cells around the cell is returned.
+**********************************************************************/
+Value Board::CountCellValue(int row, int column) const
+{
+	int count = 0;
+
+	for (int i = row - 1; i <= row + 1; i++)
+	{
+		const Cell * cellRow = m_arrayCells.RawRow(i);
+
+		for (int j = column - 1; j <= column + 1; j++)
+		{
+			if (cellRow[j].GetValue() == MINE)
+				count++;
+		}
+	}
+
+	return static_cast<Value>(count);
+}
+
+/**********************************************************************
+* Purpose:
+*	To copy the mines of either backend into a zero padded byte plane
+*	and let CountAdjacentMines() count every cell at once. Large
+*	boards are split into bands of rows, each copied and then counted
+*	as its own task on the thread pool. A band's counts read the rows
+*	just above and below it, so all copying is done before counting;
+*	each band then writes only its own counts, so no locking is needed.
+*
+* Precondition:
+*	The board holds its mines and is not empty.
+*
+* Postcondition:
+*	m_minePlane holds a 1 for each mine inside a padding ring of
+*	zeros, and m_mineCounts holds the # adjacent mines of each cell.
+**********************************************************************/
+void Board::CountMines()
+{
+	int numRows = GetRow();
+	int numCols = GetColumn();
+	int stride = numCols + 2;		//Padded row width of the mine plane
+	int numBands = CountBands();
+	Array<uint8_t> & minePlane = m_minePlane;	//1 for each mine
+	Array<uint8_t> & counts = m_mineCounts;		//# adjacent mines
+
+	//Scratch planes keep their storage from game to game
+	minePlane.Resize((numRows + 2) * stride);
+	counts.Resize(numRows * numCols);
+
+	//Copy mines into the plane inside its zero padding ring
+	RunBands(numBands, [&](int firstRow, int endRow)
+	{
+		for (int i = firstRow; i < endRow; i++)
+		{
+			uint8_t * planeRow = &minePlane((i + 1) * stride + 1);
+
+			if (m_backend == BITPLANE_BACKEND)
+			{
+				for (int j = 0; j < numCols; j++)
+					planeRow[j] = m_mines.Get(i, j) ? 1 : 0;
+			}
+			else if (m_backend == SPARSE_BACKEND)
+			{
+				for (int j = 0; j < numCols; j++)
+					planeRow[j] = m_mineSet.Contains(i * numCols + j) ? 1 : 0;
+			}
+			else
+			{
+				const Cell * cellRow = m_arrayCells.RawRow(i);
+
+				for (int j = 0; j < numCols; j++)
+					planeRow[j] = (cellRow[j].GetValue() == MINE) ? 1 : 0;
+			}
+		}
+	});
+
+	//Count each band, reading one row of its neighbors on each side
+	RunBands(numBands, [&](int firstRow, int endRow)
+	{
+		CountAdjacentMines(&minePlane((firstRow + 1) * stride + 1), stride, endRow - firstRow,
+			numCols, &counts(firstRow * numCols));
+	});
+}
+
+/**********************************************************************
+* Purpose:
+*	To decide how many bands of rows to split a pass over the board
+*	into. Boards under PARALLEL_MIN_CELLS cells are done in one band,
+*	since waking the pool would cost more than it saves.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The # bands, from one up to one per row, is returned.
+**********************************************************************/
+int Board::CountBands() const
+{
+	int numRows = GetRow();
+
+	if (static_cast<int64_t>(numRows) * GetColumn() < PARALLEL_MIN_CELLS)
+		return 1;
+
+	//Several bands per thread even out bands that run slow
+	int numBands = GetThreadPool()->GetThreadCount() * BANDS_PER_THREAD;
+
+	return std::min(numBands, numRows);
+}
+
+/**********************************************************************
+* Purpose:
+*	To run a pass over the board one band of rows at a time, on the
+*	thread pool when there is more than one band. While another
+*	Board's batch holds the pool, e.g. the shared default pool w/many
+*	boards built in parallel, the pool runs the bands on this thread.
+*
+* Precondition:
+*	An integer specifying the # bands (from CountBands()), and the
+*	pass, given the first row and the row past the end of a band.
+*
+* Postcondition:
+*	The pass has run over every band, which together cover each row
+*	of the board once.
+**********************************************************************/
+void Board::RunBands(int numBands, const std::function<void(int, int)> & pass) const
+{
+	int numRows = GetRow();
+
+	//Band b holds rows [numRows * b / numBands, numRows * (b + 1) / numBands)
+	auto band = [&](int b)
+	{
+		pass(static_cast<int>(static_cast<int64_t>(numRows) * b / numBands),
+			static_cast<int>(static_cast<int64_t>(numRows) * (b + 1) / numBands));
+	};
+
+	if (numBands == 1)
+		band(0);
+	else
+		GetThreadPool()->Run(numBands, band);
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the thread pool the Board splits its work over.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The pool set by SetThreadPool(), or the shared default pool, is
+*	returned.
+**********************************************************************/
+ThreadPool * Board::GetThreadPool() const
+{
+	return (m_threadPool != nullptr) ? m_threadPool : ThreadPool::GetDefault();
+}
+
+/**********************************************************************
+* Purpose:
+*	To determine whether a row and column pair is on the Board.
+*
+* Precondition:
+*	Two integers specifying a row and column pair.
+*
+* Postcondition:
+*	A bool specifying whether the cell is on the Board is returned.
+**********************************************************************/
+bool Board::InBounds(int row, int column) const
+{
+	return row >= 0 && row < GetRow() && column >= 0 && column < GetColumn();
+}
+
+/**********************************************************************
+* Purpose:
+*	To determine whether a cell holds a mine, without the bounds check
+*	done by IsMine().
+*
+* Precondition:
+*	Two integers specifying a row and column pair on the Board.
+*
+* Postcondition:
+*	A bool specifying whether the cell holds a mine is returned.
+**********************************************************************/
+bool Board::HasMine(int row, int column) const
+{
+	if (m_backend == BITPLANE_BACKEND)
+		return m_mines.Get(row, column);
+	if (m_backend == SPARSE_BACKEND)
+		return m_mineSet.Contains(row * GetColumn() + column);
+
+	return m_arrayCells.RawRow(row)[column].GetValue() == MINE;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the state of a cell from the backend holding the Board.
+*
+* Precondition:
+*	Two integers specifying a row and column pair on the Board, or on
+*	the padding ring around a CELL_BACKEND board.
+*
+* Postcondition:
+*	The state of the cell is returned.
+**********************************************************************/
+State Board::GetCellState(int row, int column) const
+{
+	if (m_backend != CELL_BACKEND)
+	{
+		if (m_uncovered.Get(row, column))
+			return UNCOVERED;
+		if (m_flagged.Get(row, column))
+			return FLAGGED;
+		return COVERED;
+	}
+
+	return m_arrayCells.RawRow(row)[column].GetState();
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the value of a cell from the backend holding the Board.
+*
+* Precondition:
+*	Two integers specifying a row and column pair on the Board, or on
+*	the padding ring around a CELL_BACKEND board.
+*
+* Postcondition:
+*	The value of the cell is returned. For BitPlanes the number of
+*	adjacent mines is counted from the mine plane.
+**********************************************************************/
+Value Board::GetCellValue(int row, int column) const
+{
+	if (m_backend == BITPLANE_BACKEND)
+	{
+		if (m_mines.Get(row, column))
+			return MINE;
+		return static_cast<Value>(m_mines.CountNeighbors(row, column));
+	}
+	if (m_backend == SPARSE_BACKEND)
+	{
+		if (m_mineSet.Contains(row * GetColumn() + column))
+			return MINE;
+
+		int count = 0;
+		for (int i = row - 1; i <= row + 1; i++)
+			for (int j = column - 1; j <= column + 1; j++)
+				if (InBounds(i, j) && m_mineSet.Contains(i * GetColumn() + j))
+					count++;
+
+		return static_cast<Value>(count);
+	}
+
+	//A count not made yet is made now, but only EnsureCounted() stores
+	//it. Until the mines are placed, every cell reads as zero.
+	const Cell & cell = m_arrayCells.RawRow(row)[column];
+
+	if (m_minesPlaced && !cell.IsCounted() && cell.GetValue() != MINE)
+		return CountCellValue(row, column);
+
+	return cell.GetValue();
+}
+
+/**********************************************************************
+* Purpose:
+*	To set the state of a cell in the backend holding the Board.
+*
+* Precondition:
+*	Two integers specifying a row and column pair on the Board, and
+*	the desired state of the cell.
+*
+* Postcondition:
+*	The state of the cell is set to the parameter value, and the
+*	running counters WonGame() uses are updated.
+**********************************************************************/
+void Board::SetCellState(int row, int column, State state)
+{
+	State oldState = GetCellState(row, column);
+	bool mine = HasMine(row, column);
+
+	//Keep # covered non-mine cells up to date
+	if (!mine && oldState == UNCOVERED && state != UNCOVERED)
+		m_numCoveredSafe++;
+	else if (!mine && oldState != UNCOVERED && state == UNCOVERED)
+		m_numCoveredSafe--;
+
+	//Keep # flags & # flagged mines up to date
+	if (oldState != FLAGGED && state == FLAGGED)
+	{
+		m_numFlags++;
+		if (mine)
+			m_numMinesFlagged++;
+	}
+	else if (oldState == FLAGGED && state != FLAGGED)
+	{
+		m_numFlags--;
+		if (mine)
+			m_numMinesFlagged--;
+	}
+
+	//Uncovered cells keep their lazy count, so renders find it stored
+	if (state == UNCOVERED)
+		EnsureCounted(row, column);
+
+	//A zero region stops matching its list once one of its zero cells
+	//is flagged or uncovered
+	if (m_regionIndexBuilt && state != COVERED)
+	{
+		int region = m_regionIds(row * GetColumn() + column);
+
+		if (region >= 0)
+			m_regionTouched(region) = true;
+	}
+
+	//Record the change for this move's delta stream
+	AppendDelta(row, column, state);
+
+	if (m_backend != CELL_BACKEND)
+	{
+		//A cell is in at most one of the uncovered & flagged planes
+		m_uncovered.Clear(row, column);
+		m_flagged.Clear(row, column);
+
+		if (state == UNCOVERED)
+			m_uncovered.Set(row, column);
+		else if (state == FLAGGED)
+			m_flagged.Set(row, column);
+	}
+	else
+		m_arrayCells.RawRow(row)[column].SetState(state);
+}
+
+/**********************************************************************
+* Purpose:
+*	To add a changed cell to the delta buffer, doubling the buffer
+*	when it is full. The buffer keeps its storage from move to move,
+*	so once it has grown to the largest move, moves don't allocate.
+*
+* Precondition:
+*	Two integers specifying a row and column pair, and the cell's new
+*	state.
+*
+* Postcondition:
+*	The change is the last delta of the current move.
+**********************************************************************/
+void Board::AppendDelta(int row, int column, State state)
+{
+	//If buffer is full, double it (keeping the deltas)
+	if (m_numDeltas == m_deltas.getLength())
+		m_deltas.setLength(m_numDeltas > 0 ? m_numDeltas * 2 : DELTA_INITIAL_CAPACITY);
+
+	CellDelta & delta = m_deltas(m_numDeltas);
+	delta.row = row;
+	delta.column = column;
+	delta.state = state;
+
+	m_numDeltas++;
+}
+
+/**********************************************************************
+* Purpose:
+*	To place a mine in a cell of the backend holding the Board.
+*
+* Precondition:
+*	Two integers specifying a row and column pair on the Board.
+*
+* Postcondition:
+*	The cell holds a mine.
+**********************************************************************/
+void Board::SetMine(int row, int column)
+{
+	if (m_backend == BITPLANE_BACKEND)
+		m_mines.Set(row, column);
+	else if (m_backend == SPARSE_BACKEND)
+		m_mineSet.Insert(row * GetColumn() + column);
+	else
+		m_arrayCells.RawRow(row)[column].SetValue(MINE);
+}
+
+/**********************************************************************
+* Purpose:
+*	To take a mine out of a cell in the backend holding the Board.
+*
+* Precondition:
+*	Two integers specifying a row and column pair on the Board. The
+*	adjacency counts haven't been assigned yet.
+*
+* Postcondition:
+*	The cell holds no mine.
+**********************************************************************/
+void Board::ClearMine(int row, int column)
+{
+	if (m_backend == BITPLANE_BACKEND)
+		m_mines.Clear(row, column);
+	else if (m_backend == SPARSE_BACKEND)
+		m_mineSet.Erase(row * GetColumn() + column);
+	else
+		m_arrayCells.RawRow(row)[column].SetValue(NO_ADJ_MINES);
+}
+
+/**********************************************************************
+* Purpose:
+*	To let generic code (and std::swap callers using ADL) exchange two
+*	Boards without copying them.
+*
+* Precondition:
+*	Two existing Board objects passed by ref.
+*
+* Postcondition:
+*	Each Board holds the data the other held before.
+**********************************************************************/
+void swap(Board & lhs, Board & rhs) noexcept
+{
+	lhs.swap(rhs);
+}
\ No newline at end of file
@@ -2,7 +2,7 @@
 * Author:			Molli Drivdahl
 * Filename:			board.h
 * Date Created:		1/12/16
-* Modifications:	1/17/16
+* Modifications:	10/17/26
 *
 * Class: Board
 *
@@ -16,51 +16,263 @@
 *		Creates a Board with an Array2D of Cells and the number of
 *		mines initialized to zero.
 *
+*	explicit Board(MemoryResource * resource)
+*		Creates an empty Board that draws all of its storage from the
+*		given resource, e.g. a MonotonicArena owned by the caller.
+*
 *	Board(const Board & copy)
 *
+*	Board(Board && move)
+*		Takes over the data of an expiring Board without copying it.
+*
 *	~Board()
 *
 *	Board & operator=(const Board & rhs)
 *
+*	Board & operator=(Board && rhs)
+*		Takes over the data of an expiring Board without copying it.
+*
+*	void swap(Board & other)
+*		Exchanges the data of two Boards without copying it.
+*
 * Methods:
-*	void CreateBoard(int row, int column, int numMines)
+*	void CreateBoard(int row, int column, int numMines,
+*					 Backend backend = DEFAULT_BACKEND)
+*	void CreateBoard(int row, int column, int numMines, uint64_t seed,
+*					 Backend backend = DEFAULT_BACKEND)
 *		Creates a board w/specified number of rows, columns, and mines
-*		as given by the parameters.
+*		as given by the parameters, stored in the specified backend.
+*		The mines are placed from the given seed, so a seed always
+*		gives the same board, or from a new seed for every game.
+*		Unless SetFirstClick() asked for a safe first click, they are
+*		placed right away. Throws an Exception if a size is negative
+*		or the # of mines is not from zero to the # of cells.
+*
+*	void SetFirstClick(FirstClick firstClick)
+*		Chooses whether the mines are placed by CreateBoard() or left
+*		off the board until the first uncover, which then never hits
+*		a mine (and, w/FIRST_CLICK_OPENING, never borders one).
+*
+*	void SetGeneration(Generation generation)
+*		Chooses how the mines are placed: shuffled in one pass, or
+*		made tile by tile in parallel from a counter-based generator.
 *
-*	void UncoverCell(int row, int column)
-*		Marks the cell given by the row and column pair as uncovered.
+*	void SetThreadPool(ThreadPool * pool)
+*		Sets the pool tiled generation and the adjacency counts of
+*		large boards run on (nullptr for the shared default pool),
+*		and so how many threads they use. The Board shares the pool
+*		but does not own it. Boards made on several threads at once
+*		may share a pool; a pass that finds it busy runs on its own
+*		thread.
 *
-*	void FlagCell(int row, int column)
+*	MoveResult TryUncover(int row, int column)
+*		Marks the cell given by the row and column pair as uncovered,
+*		placing the mines first if they are still to be placed.
+*		Returns whether the move was legal, hit a mine, or won the
+*		game, and how many cells it uncovered. Never throws.
+*
+*	MoveResult TryFlag(int row, int column)
 *		Marks the cell given by the row and column pair as flagged.
+*		Never throws.
 *
-*	void RemoveFlaggedCell(int row, int column)
+*	MoveResult TryUnflag(int row, int column)
 *		Removes a flag from the cell given by the row and column pair.
+*		Never throws.
+*
+*	MoveResult UncoverCell(int row, int column)
+*	MoveResult FlagCell(int row, int column)
+*	MoveResult RemoveFlaggedCell(int row, int column)
+*		Same as the Try methods, but throw an Exception for an illegal
+*		move instead of returning it.
 *
 *	bool IsMine(int row, int column)
 *		Checks if the cell given by the row and column pair contains
 *		a mine.
 *
-*	void DisplayBoard()
-*		Displays the board data as its current state in the game.
+*	State GetCellState(int row, int column) const
+*	Value GetCellValue(int row, int column) const
+*		Return the state and value of the cell given by the row and
+*		column pair, which must be on the board. Renderers draw the
+*		board w/these. A value not yet counted is counted, but not
+*		stored.
 *
 *	bool WonGame()
-*		Checks if the user has won the game.
+*		Checks if the user has won the game, in constant time from
+*		running counters kept up to date by every state change.
+*
+*	int GetMinesRemaining() const
+*		Returns the number of mines minus the number of flags.
+*
+*	int GetCellsLeft() const
+*		Returns the number of non-mine cells still to uncover.
+*
+*	const CellDelta * GetDeltas() const
+*	int GetDeltaCount() const
+*		Return the cells the latest move changed (including every
+*		cell its flood fill uncovered), straight from the Board's
+*		reusable delta buffer. Valid until the next move.
+*
+*	unsigned int GetMoveNumber() const
+*		Returns the number of legal moves since CreateBoard().
+*
+*	CellCoord GetLastMove() const
+*		Returns the cell the latest legal move was made on.
+*
+*	uint64_t GetSeed() const
+*		Returns the seed the mines were placed from.
+*
+*	void UseRegionIndex(bool use)
+*		Turns the zero-region index on (the default) or off.
+*
+*	void UseLazyValues(bool use)
+*		Chooses whether the next CreateBoard() leaves the adjacency
+*		counts of a CELL_BACKEND board to be counted as cells are
+*		uncovered, or counts them all up front (the default).
+*
+*	int GetZeroRegionCount()
+*		Returns the number of connected regions of cells w/zero
+*		adjacent mines, building the zero-region index if needed.
+*
+*	int GetRow() const
+*		Returns the number of rows on the board.
+*
+*	int GetColumn() const
+*		Returns the number of columns on the board.
 *
 *	void ResetEmptyBoard()
 *		Removes the rows and columns from the board so that it can be
-*		removed of the data.
+*		removed of the data. The storage is kept for the next game.
+*
+*	void PlaceMines(int row, int column)
+*		Places the deferred mines around the first cell uncovered,
+*		keeping them off it (and its neighbors) and fixing the
+*		counters that depend on where the mines are.
 *
-*	void ShuffleMines()
+*	void ShuffleMines(const int64_t * excluded, int numExcluded)
 *		Randomizes the placement of the mines in the cells on the
-*		board.
+*		board, except the excluded ones, in time proportional to the
+*		# mines.
+*
+*	void TileMines(const int64_t * excluded, int numExcluded)
+*		Places the same mines, spread the same way, from a generator
+*		that makes each tile of the board on its own, on every thread
+*		of the pool.
 *
 *	void AssignCellValues()
 *		Increments the value for the number of adjacent mines for each
 *		cell around any given cell with a mine.
 *
-*	void FloodFill(int row, int column)
-*		Uncovers more cells upon uncovering the cell given by the row
-*		and column pair if the cell has zero adjacent mines.
+*	Value CountCellValue(int row, int column) const
+*		Counts the mines around one cell of a CELL_BACKEND board.
+*
+*	int FloodFill(int row, int column)
+*		Uncovers the region around the cell given by the row and
+*		column pair, which has zero adjacent mines, w/an iterative
+*		scanline fill. Returns the number of cells uncovered.
+*
+*	bool IsCoveredZero(int row, int column)
+*		Checks if the flood fill can spread into a cell.
+*
+*	Value EnsureCounted(int row, int column)
+*		Returns the value of a cell, storing the count of a lazily
+*		counted cell the first time it is needed.
+*
+*	int RevealZeroRegion(int row, int column)
+*		Uncovers the region around a cell w/zero adjacent mines from
+*		the zero-region index, or w/FloodFill() when the index is off,
+*		the board is small, or the region was touched before.
+*
+*	void BuildRegionIndex()
+*		Labels every zero region and lists its cells & border.
+*
+*	int GetBorderRegions(int row, int column, int * regions) const
+*		Finds the distinct zero regions a numbered cell borders.
+*
+*	void CountMines()
+*		Fills the scratch planes w/the mines & adjacency counts of
+*		either backend, in bands of rows on the thread pool.
+*
+*	int CountBands() const
+*		Returns how many bands of rows to split a pass over the board
+*		into: one for boards under PARALLEL_MIN_CELLS cells.
+*
+*	void RunBands(int numBands,
+*				  const std::function<void(int, int)> & pass) const
+*		Runs a pass over each band of rows, on the thread pool if
+*		there is more than one and no other batch holds the pool.
+*
+*	ThreadPool * GetThreadPool() const
+*		Returns the pool the Board splits its work over.
+*
+*	bool InBounds(int row, int column) const
+*	bool HasMine(int row, int column) const
+*	void SetCellState(int row, int column, State state)
+*	void SetMine(int row, int column)
+*	void ClearMine(int row, int column)
+*		Read and write single cells through whichever backend the
+*		board was created with. SetCellState() also updates the
+*		running counters.
+*
+*	void AppendDelta(int row, int column, State state)
+*		Adds a changed cell to the delta buffer.
+*
+*	bool CountersMatchBoard() const
+*		Checks the running counters against a full rescan. Debug
+*		builds run it in WonGame().
+*
+*	bool StatesMatch(const Board & other) const
+*		Checks every cell state against another board of the same
+*		size. Debug builds run it in RevealZeroRegion() to compare a
+*		list walk w/a flood fill.
+*
+* Backends:
+*	CELL_BACKEND keeps a padded Array2D of packed Cells with the
+*	adjacency counts stored in each Cell. The padding ring holds
+*	uncovered, mine-free sentinels, so its cells are reached through
+*	Array2D::RawRow() without edge checks. After UseLazyValues(true),
+*	CreateBoard() only places the mines; a cell's count is worked out
+*	from its neighbors when the moves first need it and stored in the
+*	Cell, so the cells of a huge board that are never uncovered are
+*	never counted. Const reads count uncounted cells w/o storing them,
+*	so a Board shared between readers is never written by them.
+*	BITPLANE_BACKEND keeps the mines,
+*	uncovered cells, and flags as three BitPlanes; adjacency counts are
+*	derived from the mine plane when asked for. SPARSE_BACKEND keeps
+*	the mines in a CellSet, so they take memory in proportion to their
+*	#, w/the uncovered cells and flags in BitPlanes (1 bit per cell);
+*	adjacency counts are looked up in the set when asked for.
+*	AUTO_BACKEND, the default, picks SPARSE_BACKEND for boards of at
+*	least SPARSE_MIN_CELLS cells w/fewer than one mine per
+*	SPARSE_CELLS_PER_MINE cells, and CELL_BACKEND otherwise.
+*	Defining MINESWEEPER_BITPLANE_BACKEND makes BitPlanes the default.
+*
+* Tiled generation:
+*	GENERATE_TILED splits the board into MINE_TILE_SIZE square tiles.
+*	Each cell of a tile is a mine w/the board's mine density, judged
+*	from Philox4x32 output for the (seed, tile, cell) counter, so a
+*	tile comes out the same whichever thread makes it. The density
+*	depends on the board's size & # of mines, so a tile is only
+*	reproducible for the same seed, size, and # of mines. The few
+*	mines too many or too few are then taken out of or added to cells
+*	picked uniformly by one generator, so the board gets exactly its
+*	# of mines, every placement equally likely, and the same board for
+*	a seed on any # of threads.
+*	Sparse boards shuffle their mines instead, since tiles visit
+*	every cell.
+*
+* Zero-region index:
+*	On boards of at least REGION_INDEX_MIN_CELLS cells, the first
+*	reveal of a zero cell labels every connected region of zero cells
+*	(8-way, w/union-find) and stores a region id for each cell plus,
+*	for each region, a list of its cells and its numbered border.
+*	Later zero reveals walk that list instead of flood filling. The
+*	index only depends on where the mines are, so it lasts until the
+*	next CreateBoard(). The list only matches a flood fill while every
+*	zero cell of the region is still covered, so each region is marked
+*	touched once any of its zero cells is flagged or uncovered, and a
+*	reveal in a touched region flood fills instead.
+*	Sparse boards, whose mines take far less memory than the index
+*	would, always flood fill.
 **********************************************************************/
 
 #ifndef BOARD_H
@@ -68,6 +280,13 @@
 
 #include "row.h"
 #include "cell.h"
+#include "bitplane.h"
+#include "cellset.h"
+#include "stack.h"
+
+#include <functional>
+
+class ThreadPool;
 
 //Row & column size for beginner level
 const int SMALL_SIZE = 10;
@@ -81,6 +300,94 @@ const int BEGINNER_MINES = 10;
 const int INTERMEDIATE_MINES = 40;
 //# mines for expert level
 const int EXPERT_MINES = 100;
+//Largest row & column size for a custom board
+const int MAX_CUSTOM_SIZE = 10000;
+
+//Capacity of the first delta buffer a Board allocates
+const int DELTA_INITIAL_CAPACITY = 64;
+
+//Smallest board that builds a zero-region index
+const int REGION_INDEX_MIN_CELLS = 4096;
+
+//Smallest board whose adjacency counts are split over threads
+const int PARALLEL_MIN_CELLS = 1 << 20;
+
+//Bands of rows per thread when adjacency counts are split
+const int BANDS_PER_THREAD = 4;
+
+//Row & column size of the tiles GENERATE_TILED makes mines in
+//(a multiple of 64, so no two tiles share a BitPlane word)
+const int MINE_TILE_SIZE = 256;
+
+//Ways a board can store its cells
+enum Backend
+{
+	CELL_BACKEND,		//Array2D of Cells
+	BITPLANE_BACKEND,	//Mine, uncovered, and flag BitPlanes
+	SPARSE_BACKEND,		//CellSet of mines, uncovered & flag BitPlanes
+	AUTO_BACKEND		//SPARSE_BACKEND for large, sparse boards, else CELL_BACKEND
+};
+
+//Backend used when CreateBoard isn't given one
+#ifdef MINESWEEPER_BITPLANE_BACKEND
+const Backend DEFAULT_BACKEND = BITPLANE_BACKEND;
+#else
+const Backend DEFAULT_BACKEND = AUTO_BACKEND;
+#endif
+
+//AUTO_BACKEND stores a board sparse if it has fewer mines than one per
+//SPARSE_CELLS_PER_MINE cells, and at least SPARSE_MIN_CELLS cells
+const int SPARSE_CELLS_PER_MINE = 100;
+const int SPARSE_MIN_CELLS = 1 << 16;
+
+//When a board's mines are placed
+enum FirstClick
+{
+	FIRST_CLICK_ANY,		//By CreateBoard, so the first uncover may hit one
+	FIRST_CLICK_SAFE,		//On the first uncover, never on its cell
+	FIRST_CLICK_OPENING		//On the first uncover, never on its cell or neighbors
+};
+
+//How a board's mines are placed
+enum Generation
+{
+	GENERATE_SHUFFLE,	//Floyd's algorithm on one thread
+	GENERATE_TILED		//Counter-based tiles on a thread pool
+};
+
+//Outcome of a move. Legal moves come before MOVE_OUT_OF_BOUNDS.
+enum MoveStatus
+{
+	MOVE_OK,				//Move made, game goes on
+	MOVE_WON,				//Move made & game won
+	MOVE_HIT_MINE,			//Uncovered a mine, game lost
+	MOVE_OUT_OF_BOUNDS,		//Cell is not part of the board
+	MOVE_ALREADY_UNCOVERED,	//Cell is already uncovered
+	MOVE_FLAGGED,			//Cell is flagged
+	MOVE_NOT_FLAGGED		//Cell to unflag has no flag
+};
+
+//Row & column pair of a cell
+struct CellCoord
+{
+	int row;
+	int column;
+};
+
+//A cell a move changed
+struct CellDelta
+{
+	int row;
+	int column;
+	State state;	//State the cell was changed to
+};
+
+//What a move did
+struct MoveResult
+{
+	MoveStatus status;	//Outcome of the move
+	int revealed;		//# cells the move uncovered
+};
 
 class Board
 {	
@@ -88,51 +395,185 @@ class Board
 		//Default Ctor
 		Board();
 
+		//Board drawing storage from a resource
+		explicit Board(MemoryResource * resource);
+
 		//Copy Ctor
 		Board(const Board & copy);
 
+		//Move Ctor
+		Board(Board && move) noexcept;
+
 		//Default Dtor
 		~Board();
 
 		//Assignment Operator
 		Board & operator=(const Board & rhs);
 
+		//Move Assignment Operator
+		Board & operator=(Board && rhs) noexcept;
+
+		//Exchange data with another Board
+		void swap(Board & other) noexcept;
+
 		//Create board w/specified size & # of mines
-		void CreateBoard(int row, int column, int numMines);
+		void CreateBoard(int row, int column, int numMines, Backend backend = DEFAULT_BACKEND);
+		void CreateBoard(int row, int column, int numMines, uint64_t seed,
+			Backend backend = DEFAULT_BACKEND);
+
+		//Place mines now, or keep them off the first uncover
+		void SetFirstClick(FirstClick firstClick);
+
+		//Shuffle mines or make them tile by tile
+		void SetGeneration(Generation generation);
+
+		//Pool tiled generation runs on
+		void SetThreadPool(ThreadPool * pool);
+
+		//Make a move, reporting illegal moves in the result
+		MoveResult TryUncover(int row, int column);
+		MoveResult TryFlag(int row, int column);
+		MoveResult TryUnflag(int row, int column);
 
 		//Mark a cell as uncovered
-		void UncoverCell(int row, int column);
+		MoveResult UncoverCell(int row, int column);
 
 		//Mark a cell as flagged
-		void FlagCell(int row, int column);
+		MoveResult FlagCell(int row, int column);
 
 		//Remove a flag from a cell
-		void RemoveFlaggedCell(int row, int column);
+		MoveResult RemoveFlaggedCell(int row, int column);
 
 		//Check if a cell contains a mine
 		bool IsMine(int row, int column);
 
-		//Display current state of the board
-		void DisplayBoard();
+		//Read a cell on the board (no bounds check)
+		State GetCellState(int row, int column) const;
+		Value GetCellValue(int row, int column) const;
 
 		//Check if user won the game
 		bool WonGame();
 
+		//Game state for display
+		int GetMinesRemaining() const;
+		int GetCellsLeft() const;
+
+		//Cells changed by the latest move
+		const CellDelta * GetDeltas() const;
+		int GetDeltaCount() const;
+		unsigned int GetMoveNumber() const;
+		CellCoord GetLastMove() const;
+
+		//Seed the mines were placed from
+		uint64_t GetSeed() const;
+
 		//Give board zero rows and columns to remove data
 		void ResetEmptyBoard();
-		
+
+		//Turn zero-region index on or off
+		void UseRegionIndex(bool use);
+
+		//Count adjacent mines as cells are read, or up front
+		void UseLazyValues(bool use);
+
+		//# connected regions of zero cells
+		int GetZeroRegionCount();
+
+		//Getters for board size
+		int GetRow() const;
+		int GetColumn() const;
+
 	private:
-		//Places mines in random cells on board
-		void ShuffleMines();
+		//Place deferred mines around the first uncover
+		void PlaceMines(int row, int column);
+
+		//Places mines in random cells on board, except excluded ones
+		void ShuffleMines(const int64_t * excluded, int numExcluded);
+
+		//Places mines tile by tile on the thread pool, except excluded ones
+		void TileMines(const int64_t * excluded, int numExcluded);
 
 		//Increment cell values around each mine
 		void AssignCellValues();
 
+		//Count the mines around one cell
+		Value CountCellValue(int row, int column) const;
+
 		//Uncover more cells upon uncovering a cell w/zero adjacent mines
-		void FloodFill(int row, int column);
+		int FloodFill(int row, int column);
+
+		//Check if a cell is covered w/zero adjacent mines
+		bool IsCoveredZero(int row, int column);
+
+		//Value of a cell, storing a lazy count
+		Value EnsureCounted(int row, int column);
+
+		//Uncover a zero cell's region, from the index when possible
+		int RevealZeroRegion(int row, int column);
+
+		//Label zero regions & list their cells
+		void BuildRegionIndex();
+
+		//Distinct zero regions around a numbered cell
+		int GetBorderRegions(int row, int column, int * regions) const;
+
+		//Fill scratch planes w/mines & adjacency counts
+		void CountMines();
+
+		//Split passes over the board into bands of rows
+		int CountBands() const;
+		void RunBands(int numBands, const std::function<void(int, int)> & pass) const;
+		ThreadPool * GetThreadPool() const;
+
+		//Backend independent single cell access
+		bool InBounds(int row, int column) const;
+		bool HasMine(int row, int column) const;
+		void SetCellState(int row, int column, State state);
+		void SetMine(int row, int column);
+		void ClearMine(int row, int column);
+
+		//Record a changed cell
+		void AppendDelta(int row, int column, State state);
+
+		//Rescan board to check running counters
+		bool CountersMatchBoard() const;
+
+		//Compare every cell state w/another board
+		bool StatesMatch(const Board & other) const;
 
 		Array2D<Cell> m_arrayCells;		//2D array of Cells holding board data
+		BitPlane m_mines;		//Cells holding mines (BITPLANE_BACKEND)
+		BitPlane m_uncovered;	//Uncovered cells (BITPLANE_ & SPARSE_BACKEND)
+		BitPlane m_flagged;		//Flagged cells (BITPLANE_ & SPARSE_BACKEND)
+		CellSet m_mineSet;		//Cells holding mines (SPARSE_BACKEND)
+		Array<uint8_t> m_minePlane;		//Scratch mine plane for AssignCellValues
+		Array<uint8_t> m_mineCounts;	//Scratch counts for AssignCellValues
+		Stack<CellCoord> m_fillStack;	//Work stack reused by FloodFill
+		Array<int> m_regionIds;		//Zero region of each cell, -1 if not a zero cell
+		Array<int> m_regionStarts;	//Where each region starts in m_regionCells
+		Array<int> m_regionCells;	//Cells (row * # columns + column) of each region & its border
+		Array<bool> m_regionTouched;	//Whether a zero cell of each region was ever flagged or uncovered
+		int m_numRegions;			//# zero regions in the index
+		bool m_regionIndexBuilt;	//Whether the index matches the mines
+		bool m_useRegionIndex;		//Whether zero reveals may use the index
+		bool m_useLazyValues;		//Whether CreateBoard skips AssignCellValues
+		Backend m_backend;	//Which storage holds the board data
 		int m_numMines;		//Contains total number of mines on board
+		int m_numCoveredSafe;	//# non-mine cells not yet uncovered
+		int m_numFlags;			//# flagged cells
+		int m_numMinesFlagged;	//# flagged cells holding mines
+		Array<CellDelta> m_deltas;	//Cells changed by the latest move
+		int m_numDeltas;			//# deltas in use
+		unsigned int m_moveNumber;	//# legal moves since CreateBoard
+		CellCoord m_lastMove;		//Cell of the latest legal move
+		uint64_t m_seed;			//Seed the mines were placed from
+		FirstClick m_firstClick;	//When the mines are placed
+		bool m_minesPlaced;			//Whether the mines are on the board yet
+		Generation m_generation;	//How the mines are placed
+		ThreadPool * m_threadPool;	//Pool for tiled generation & row bands (not owned)
 };
 
+//Exchange two Boards without copying them
+void swap(Board & lhs, Board & rhs) noexcept;
+
 #endif //BOARD_H
\ No newline at end of file
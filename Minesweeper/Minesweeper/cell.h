@@ -2,7 +2,7 @@
 * Author:			Molli Drivdahl
 * Filename:			cell.h
 * Date Created:		1/12/16
-* Modifications:	1/17/16
+* Modifications:	10/17/26
 *
 * Class: Cell
 *
@@ -15,11 +15,9 @@
 *		Creates a Cell with initial state set to covered and initial
 *		value set to no adjacent mines.
 *
-*	Cell(const Cell & copy)
-*
-*	~Cell()
-*
-*	Cell & operator=(const Cell & rhs)
+*	The copy ctor, dtor, and assignment operator are the compiler
+*	generated ones, so a Cell is trivially copyable and an Array of
+*	Cells copies as plain memory.
 *
 * Methods:
 *	void SetState(State setter)
@@ -35,11 +33,26 @@
 *
 *	Value GetValue() const
 *		Returns the value of the Cell as one of the Value enum values.
+*
+*	void SetCounted()
+*	bool IsCounted() const
+*		Mark and check that the value holds the # of adjacent mines,
+*		for boards that count them lazily.
+*
+* Storage:
+*	The state and value are packed into a single byte. The state lives
+*	in bits 0-1, the value in bits 2-5, and the counted mark in bit 6,
+*	so all the methods are inline bit operations defined in this
+*	header.
 **********************************************************************/
 
 #ifndef CELL_H
 #define CELL_H
 
+#include "zerodefault.h"
+
+#include <cstdint>
+
 //Cell can have any of these states
 enum State
 {
@@ -67,28 +80,54 @@ class Cell
 {
 	public:
 		//Default Ctor
-		Cell();
-
-		//Copy Ctor
-		Cell(const Cell & copy);
-		
-		//Default Dtor
-		~Cell();
+		constexpr Cell() : m_bits(0)
+		{}
 
-		//Assignment Operator
-		Cell & operator=(const Cell & rhs);
+		//Setter for state and value bits
+		void SetState(State setter)
+		{
+			m_bits = static_cast<uint8_t>((m_bits & ~STATE_MASK) | setter);
+		}
+		void SetValue(Value setter)
+		{
+			m_bits = static_cast<uint8_t>((m_bits & ~VALUE_MASK) | (setter << VALUE_SHIFT));
+		}
 
-		//Setter for m_state and m_value
-		void SetState(State setter);
-		void SetValue(Value setter);
+		//Getters for state and value bits
+		constexpr State GetState() const
+		{
+			return static_cast<State>(m_bits & STATE_MASK);
+		}
+		constexpr Value GetValue() const
+		{
+			return static_cast<Value>((m_bits & VALUE_MASK) >> VALUE_SHIFT);
+		}
 
-		//Getters for m_state and m_value
-		State GetState() const;
-		Value GetValue() const;
+		//Mark & check that the value is an adjacency count
+		void SetCounted()
+		{
+			m_bits = static_cast<uint8_t>(m_bits | COUNTED_MASK);
+		}
+		constexpr bool IsCounted() const
+		{
+			return (m_bits & COUNTED_MASK) != 0;
+		}
 
 	private:
-		State m_state;	//Stores Cell state
-		Value m_value;	//Stores Cell value
+		static const uint8_t STATE_MASK = 0x03;	//Bits 0-1 hold the state
+		static const uint8_t VALUE_MASK = 0x3C;	//Bits 2-5 hold the value
+		static const int VALUE_SHIFT = 2;		//Position of value bits
+		static const uint8_t COUNTED_MASK = 0x40;	//Bit 6 marks a counted value
+
+		uint8_t m_bits;	//Packed Cell state and value
 };
 
+static_assert(sizeof(Cell) == 1, "Cell must pack into a single byte");
+
+//A default Cell (covered, no adjacent mines) is all zero bits, so Arrays
+//of Cells can be allocated already zeroed
+template <>
+struct IsZeroDefault<Cell> : std::true_type
+{};
+
 #endif //CELL_H
\ No newline at end of file
@@ -0,0 +1,368 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			cellset.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "cellset.h"
+
+#include <cstdint>
+
+//Fewest slots a CellSet w/any cells has
+const int MIN_CELLSET_SLOTS = 16;
+
+/**********************************************************************
+* Purpose:
+*	To construct an empty CellSet.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The CellSet has no cells and no slots.
+**********************************************************************/
+CellSet::CellSet() : m_count(0)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct an empty CellSet that will get its storage from the
+*	given resource.
+*
+* Precondition:
+*	The resource to get storage from (nullptr for the heap). The
+*	resource must outlive the CellSet.
+*
+* Postcondition:
+*	The CellSet has no cells and no slots.
+**********************************************************************/
+CellSet::CellSet(MemoryResource * resource) : m_slots(resource), m_count(0)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a CellSet with data members whose
+*	initial values are copied from an existing CellSet object.
+*
+* Precondition:
+*	An existing CellSet object passed by const ref.
+*
+* Postcondition:
+*	The data members are initialized to the values of the data members
+*	of the existing CellSet object.
+**********************************************************************/
+CellSet::CellSet(const CellSet & copy) : m_count(0)
+{
+	*this = copy;	//Use assignment operator
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a CellSet by taking over the data of
+*	an expiring CellSet object instead of copying it.
+*
+* Precondition:
+*	An expiring CellSet object passed by rvalue ref.
+*
+* Postcondition:
+*	The data members hold the data of the expiring CellSet, which is
+*	left empty.
+**********************************************************************/
+CellSet::CellSet(CellSet && move) noexcept : m_slots(std::move(move.m_slots)),
+m_count(move.m_count)
+{
+	//Leave expiring CellSet empty
+	move.m_count = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To reset the data members to default values, and destroy the
+*	CellSet.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are reset to default values.
+**********************************************************************/
+CellSet::~CellSet()
+{
+	m_count = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To assign one existing CellSet object to another existing CellSet
+*	object by copying values of data members from one to another.
+*
+* Precondition:
+*	An existing CellSet object passed by const ref.
+*
+* Postcondition:
+*	One existing CellSet object is assigned to another existing
+*	CellSet object.
+**********************************************************************/
+CellSet & CellSet::operator=(const CellSet & rhs)
+{
+	if (this != &rhs)
+	{
+		//Use Array's assignment operator
+		m_slots = rhs.m_slots;
+		m_count = rhs.m_count;
+	}
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To assign an expiring CellSet object to an existing CellSet object
+*	by taking over its data instead of copying it.
+*
+* Precondition:
+*	An expiring CellSet object passed by rvalue ref.
+*
+* Postcondition:
+*	The existing CellSet holds the data of the expiring CellSet, which
+*	is left holding the old data of the existing CellSet until it is
+*	destroyed.
+**********************************************************************/
+CellSet & CellSet::operator=(CellSet && rhs) noexcept
+{
+	swap(rhs);
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To exchange the data of two CellSets without copying any of it.
+*
+* Precondition:
+*	An existing CellSet object passed by ref.
+*
+* Postcondition:
+*	Each CellSet holds the data the other held before.
+**********************************************************************/
+void CellSet::swap(CellSet & other) noexcept
+{
+	m_slots.swap(other.m_slots);
+	std::swap(m_count, other.m_count);
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the # cells in the set.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The # cells is returned.
+**********************************************************************/
+int CellSet::getCount() const
+{
+	return m_count;
+}
+
+/**********************************************************************
+* Purpose:
+*	To check if a cell is in the set.
+*
+* Precondition:
+*	The cell, zero or more.
+*
+* Postcondition:
+*	A bool specifying whether the cell is in the set is returned.
+**********************************************************************/
+bool CellSet::Contains(int cell) const
+{
+	return m_count > 0 && m_slots(FindSlot(cell)) == cell + 1;
+}
+
+/**********************************************************************
+* Purpose:
+*	To add a cell to the set. The table doubles before it gets more
+*	than half full, which keeps probes short.
+*
+* Precondition:
+*	The cell, zero or more.
+*
+* Postcondition:
+*	The cell is in the set.
+**********************************************************************/
+void CellSet::Insert(int cell)
+{
+	if ((m_count + 1) * 2 > m_slots.getLength())
+		Rehash(m_slots.getLength() > 0 ? m_slots.getLength() * 2 : MIN_CELLSET_SLOTS);
+
+	int slot = FindSlot(cell);
+
+	if (m_slots(slot) == 0)
+	{
+		m_slots(slot) = cell + 1;
+		m_count++;
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To take a cell out of the set. Later cells of the same probe run
+*	are shifted back into the hole, so no tombstones are left to slow
+*	down later probes.
+*
+* Precondition:
+*	The cell, zero or more.
+*
+* Postcondition:
+*	The cell is not in the set.
+**********************************************************************/
+void CellSet::Erase(int cell)
+{
+	if (m_count == 0)
+		return;
+
+	int mask = m_slots.getLength() - 1;
+	int hole = FindSlot(cell);
+
+	//If cell isn't in the set
+	if (m_slots(hole) != cell + 1)
+		return;
+
+	for (int next = (hole + 1) & mask; m_slots(next) != 0; next = (next + 1) & mask)
+	{
+		int home = HomeSlot(m_slots(next) - 1);
+
+		//If the hole is between this cell's home & its slot, fill it
+		if (((next - home) & mask) >= ((next - hole) & mask))
+		{
+			m_slots(hole) = m_slots(next);
+			hole = next;
+		}
+	}
+
+	m_slots(hole) = 0;
+	m_count--;
+}
+
+/**********************************************************************
+* Purpose:
+*	To empty the set, keeping its storage for reuse.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The set has no cells.
+**********************************************************************/
+void CellSet::Clear()
+{
+	for (int i = 0; i < m_slots.getLength(); i++)
+		m_slots(i) = 0;
+
+	m_count = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To make room for a # of cells, so inserting that many doesn't
+*	grow the table.
+*
+* Precondition:
+*	An integer specifying the # cells to make room for.
+*
+* Postcondition:
+*	The table holds at least twice that many slots.
+**********************************************************************/
+void CellSet::Reserve(int count)
+{
+	int numSlots = MIN_CELLSET_SLOTS;
+
+	while (numSlots < count * 2)
+		numSlots *= 2;
+
+	if (numSlots > m_slots.getLength())
+		Rehash(numSlots);
+}
+
+/**********************************************************************
+* Purpose:
+*	To find the slot a cell is in, or would go in, by probing from its
+*	home slot until the cell or an empty slot turns up.
+*
+* Precondition:
+*	The cell, zero or more. The table has an empty slot.
+*
+* Postcondition:
+*	The slot is returned.
+**********************************************************************/
+int CellSet::FindSlot(int cell) const
+{
+	int mask = m_slots.getLength() - 1;
+	int slot = HomeSlot(cell);
+
+	while (m_slots(slot) != 0 && m_slots(slot) != cell + 1)
+		slot = (slot + 1) & mask;
+
+	return slot;
+}
+
+/**********************************************************************
+* Purpose:
+*	To find the slot a cell's probe starts at. Cells of a board come
+*	in runs, so they're scrambled (Fibonacci hashing) to spread out.
+*
+* Precondition:
+*	The cell, zero or more. The table has slots.
+*
+* Postcondition:
+*	The home slot is returned.
+**********************************************************************/
+int CellSet::HomeSlot(int cell) const
+{
+	uint32_t mixed = static_cast<uint32_t>(cell) * 0x9E3779B1u;
+
+	return static_cast<int>((mixed ^ (mixed >> 16)) & static_cast<uint32_t>(m_slots.getLength() - 1));
+}
+
+/**********************************************************************
+* Purpose:
+*	To move every cell into a table w/a new # slots.
+*
+* Precondition:
+*	The # slots, a power of two more than twice the # cells.
+*
+* Postcondition:
+*	The table has the given # slots and holds the same cells.
+**********************************************************************/
+void CellSet::Rehash(int numSlots)
+{
+	Array<int> old(numSlots, 0, m_slots.getMemoryResource());
+
+	//New table starts empty, old cells go back in
+	old.swap(m_slots);
+
+	for (int i = 0; i < old.getLength(); i++)
+	{
+		if (old(i) != 0)
+			m_slots(FindSlot(old(i) - 1)) = old(i);
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To let generic code (and std::swap callers using ADL) exchange two
+*	CellSets without copying them.
+*
+* Precondition:
+*	Two existing CellSet objects passed by ref.
+*
+* Postcondition:
+*	Each CellSet holds the data the other held before.
+**********************************************************************/
+void swap(CellSet & lhs, CellSet & rhs) noexcept
+{
+	lhs.swap(rhs);
+}
@@ -0,0 +1,133 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			cellset.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: CellSet
+*
+* Purpose:
+*	This class stores a set of cells, each given as one non-negative
+*	integer (row * # columns + column), in an open addressing hash
+*	table w/linear probing. It takes memory in proportion to the # of
+*	cells in it, not to the size of the board, so a board w/few mines
+*	can keep them here instead of one bit or byte per cell.
+*
+* Manager functions:
+*	CellSet()
+*		Creates an empty CellSet.
+*
+*	explicit CellSet(MemoryResource * resource)
+*		Creates an empty CellSet that will get its storage from the
+*		given resource.
+*
+*	CellSet(const CellSet & copy)
+*
+*	CellSet(CellSet && move)
+*		Takes over the data of an expiring CellSet without copying it.
+*
+*	~CellSet()
+*
+*	CellSet & operator=(const CellSet & rhs)
+*
+*	CellSet & operator=(CellSet && rhs)
+*		Takes over the data of an expiring CellSet without copying it.
+*
+*	void swap(CellSet & other)
+*		Exchanges the data of two CellSets without copying it.
+*
+* Methods:
+*	int getCount() const
+*		Returns the # cells in the set.
+*
+*	bool Contains(int cell) const
+*		Checks if a cell is in the set.
+*
+*	void Insert(int cell)
+*		Adds a cell to the set, if it isn't already in it.
+*
+*	void Erase(int cell)
+*		Takes a cell out of the set, if it is in it.
+*
+*	void Clear()
+*		Empties the set but keeps its storage for reuse.
+*
+*	void Reserve(int count)
+*		Makes room for count cells, so inserting them won't grow the
+*		table.
+*
+*	int FindSlot(int cell) const
+*		Returns the slot holding a cell, or the empty slot where it
+*		would go.
+*
+*	int HomeSlot(int cell) const
+*		Returns the slot a cell's probe starts at.
+*
+*	void Rehash(int numSlots)
+*		Moves every cell into a table of the given # slots.
+**********************************************************************/
+
+#ifndef CELLSET_H
+#define CELLSET_H
+
+#include "array.h"
+
+class CellSet
+{
+public:
+	//Default Ctor
+	CellSet();
+
+	//Empty CellSet drawing storage from a resource
+	explicit CellSet(MemoryResource * resource);
+
+	//Copy Ctor
+	CellSet(const CellSet & copy);
+
+	//Move Ctor
+	CellSet(CellSet && move) noexcept;
+
+	//Default Dtor
+	~CellSet();
+
+	//Assignment Operator
+	CellSet & operator=(const CellSet & rhs);
+
+	//Move Assignment Operator
+	CellSet & operator=(CellSet && rhs) noexcept;
+
+	//Exchange data with another CellSet
+	void swap(CellSet & other) noexcept;
+
+	//Getter for m_count
+	int getCount() const;
+
+	//Single cell access
+	bool Contains(int cell) const;
+	void Insert(int cell);
+	void Erase(int cell);
+
+	//Empty the set, keeping its storage
+	void Clear();
+
+	//Make room for a # of cells
+	void Reserve(int count);
+
+private:
+	//Slot holding a cell, or where it would go
+	int FindSlot(int cell) const;
+
+	//Slot a cell's probe starts at
+	int HomeSlot(int cell) const;
+
+	//Move cells into a table of a new size
+	void Rehash(int numSlots);
+
+	Array<int> m_slots;	//Each cell + 1, or 0 for an empty slot
+	int m_count;		//# cells in the set
+};
+
+//Exchange two CellSets without copying them
+void swap(CellSet & lhs, CellSet & rhs) noexcept;
+
+#endif //CELLSET_H
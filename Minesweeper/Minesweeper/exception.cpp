@@ -2,7 +2,7 @@
 * Author:			Molli Drivdahl
 * Filename:			exception.cpp
 * Date Created:		1/4/16
-* Modifications:	1/5/16
+* Modifications:	10/17/26
 **********************************************************************/
 
 #include "exception.h"
@@ -11,6 +11,8 @@
 using std::strlen;
 using std::strcpy;
 
+#include <utility>
+
 /**********************************************************************
 * Purpose:
 *	To construct an instance of an Excecption and initialize the data
@@ -72,6 +74,24 @@ Exception::Exception(const Exception & copy) : m_msg(nullptr)
 	}
 }
 
+/**********************************************************************
+* Purpose:
+*	To construct an instance of an Exception by taking over the data of
+*	an expiring Exception object instead of copying it.
+*
+* Precondition:
+*	An expiring Exception object passed by rvalue ref.
+*
+* Postcondition:
+*	The data members hold the data of the expiring Exception, which is
+*	left w/no message (it reads as an empty string).
+**********************************************************************/
+Exception::Exception(Exception && move) noexcept : m_msg(move.m_msg)
+{
+	//Leave expiring Exception empty
+	move.m_msg = nullptr;
+}
+
 /**********************************************************************
 * Purpose:
 *	To deallocate the character pointer with the Exception message,
@@ -123,6 +143,41 @@ Exception & Exception::operator=(const Exception & rhs)
 	return *this;
 }
 
+/**********************************************************************
+* Purpose:
+*	To assign an expiring Exception object to an existing Exception object
+*	by taking over its data instead of copying it.
+*
+* Precondition:
+*	An expiring Exception object passed by rvalue ref.
+*
+* Postcondition:
+*	The existing Exception holds the data of the expiring Exception, which
+*	is left holding the old data of the existing Exception until it is
+*	destroyed.
+**********************************************************************/
+Exception & Exception::operator=(Exception && rhs) noexcept
+{
+	swap(rhs);
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To exchange the data of two Exceptions without copying any of it.
+*
+* Precondition:
+*	An existing Exception object passed by ref.
+*
+* Postcondition:
+*	Each Exception holds the data the other held before.
+**********************************************************************/
+void Exception::swap(Exception & other) noexcept
+{
+	std::swap(m_msg, other.m_msg);
+}
+
 /**********************************************************************
 * Purpose:
 *	To retrieve the value of the message.
@@ -131,11 +186,12 @@ Exception & Exception::operator=(const Exception & rhs)
 *	<None>
 *
 * Postcondition:
-*	The value of the message is returned.
+*	The value of the message is returned, or an empty string if the
+*	Exception has none (default constructed or moved from).
 **********************************************************************/
 const char * Exception::getMessage() const
 {
-	return m_msg;
+	return (m_msg != nullptr) ? m_msg : "";
 }
 
 /**********************************************************************
@@ -175,9 +231,26 @@ void Exception::setMessage(char * msg)
 *
 * Postcondition:
 *	The message of the Exception is displayed to the screen and the
-*	output stream is returned.
+*	output stream is returned. An Exception w/o a message displays
+*	nothing.
 **********************************************************************/
 ostream & operator<<(ostream & stream, const Exception & except)
 {
-	return stream << except.m_msg;
+	return stream << except.getMessage();
+}
+
+/**********************************************************************
+* Purpose:
+*	To let generic code (and std::swap callers using ADL) exchange two
+*	Exceptions without copying them.
+*
+* Precondition:
+*	Two existing Exception objects passed by ref.
+*
+* Postcondition:
+*	Each Exception holds the data the other held before.
+**********************************************************************/
+void swap(Exception & lhs, Exception & rhs) noexcept
+{
+	lhs.swap(rhs);
 }
\ No newline at end of file
@@ -2,7 +2,7 @@
 * Author:			Molli Drivdahl
 * Filename:			exception.h
 * Date Created:		1/4/16
-* Modifications:	1/5/16
+* Modifications:	10/17/26
 *
 * Class: Exception
 *
@@ -20,13 +20,23 @@
 *
 *	Exception(const Exception & copy)
 *
+*	Exception(Exception && move)
+*		Takes over the data of an expiring Exception without copying it.
+*
 *	~Exception()
 *
 *	Exception & operator=(const Exception & rhs)
 *
+*	Exception & operator=(Exception && rhs)
+*		Takes over the data of an expiring Exception without copying it.
+*
+*	void swap(Exception & other)
+*		Exchanges the data of two Exceptions without copying it.
+*
 * Methods:
 *	const char * getMessage() const
-*		Returns value of the message about the Exception.
+*		Returns value of the message about the Exception, or an empty
+*		string if it has none (e.g. once moved from).
 *
 *	void setMessage(char * msg)
 *		Sets value of the message about the Exception.
@@ -55,12 +65,21 @@ public:
 	//Copy Ctor
 	Exception(const Exception & copy);
 
+	//Move Ctor
+	Exception(Exception && move) noexcept;
+
 	//Default Dtor
 	~Exception();
 
 	//Assignment Operator
 	Exception & operator=(const Exception & rhs);
 
+	//Move Assignment Operator
+	Exception & operator=(Exception && rhs) noexcept;
+
+	//Exchange data with another Exception
+	void swap(Exception & other) noexcept;
+
 	//Getter for m_msg
 	const char * getMessage() const;
 
@@ -75,4 +94,7 @@ private:
 	char * m_msg;
 };
 
+//Exchange two Exceptions without copying them
+void swap(Exception & lhs, Exception & rhs) noexcept;
+
 #endif //EXCEPTION_H
\ No newline at end of file
@@ -0,0 +1,703 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			infiniteboard.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "infiniteboard.h"
+#include "neighborcount.h"
+
+#include <algorithm>
+#include <cstring>
+
+//Spill files can pass 2GB, so seek w/64-bit offsets
+#ifdef _MSC_VER
+#define SEEK_SPILL(file, offset) _fseeki64(file, offset, SEEK_SET)
+#else
+#define SEEK_SPILL(file, offset) fseeko(file, static_cast<off_t>(offset), SEEK_SET)
+#endif
+
+//Bytes of states a chunk spills: its uncovered & flagged words
+const int SPILL_RECORD_BYTES = 2 * CHUNK_SIZE * sizeof(uint64_t);
+
+//Padded row width of the plane a chunk's counts are made from
+const int CHUNK_STRIDE = CHUNK_SIZE + 2;
+
+/**********************************************************************
+* Purpose:
+*	To pack a chunk's row and column into one key.
+*
+* Precondition:
+*	Two integers specifying a chunk row and column pair.
+*
+* Postcondition:
+*	The key, different for every pair, is returned.
+**********************************************************************/
+static long long ChunkKey(int chunkRow, int chunkColumn)
+{
+	return static_cast<long long>((static_cast<uint64_t>(static_cast<uint32_t>(chunkRow)) << 32) |
+		static_cast<uint32_t>(chunkColumn));
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct a board w/no mines made yet, only their density.
+*
+* Precondition:
+*	The seed the mines come from, the chance of each cell being a mine
+*	(from MIN_INFINITE_DENSITY to 1), the most chunks to keep in memory
+*	(at least one), and the path of the spill file (nullptr for a
+*	temporary file deleted when the board is).
+*
+* Postcondition:
+*	An empty board is created, or an Exception is thrown if the
+*	density or # chunks is out of range or the spill file can't be
+*	made.
+**********************************************************************/
+InfiniteBoard::InfiniteBoard(uint64_t seed, double density, int maxChunks, const char * spillPath) :
+m_seed(seed), m_random(seed), m_threshold(0), m_spare(), m_maxChunks(maxChunks),
+m_numResident(0), m_newest(-1), m_oldest(-1),
+m_spillFile(nullptr), m_spillEnd(0), m_numUncovered(0), m_numFlags(0)
+{
+	if (!(density >= MIN_INFINITE_DENSITY && density <= 1.0))
+		throw Exception("ERROR: Mine density of an infinite board must be from 0.12 to 1.");
+
+	if (maxChunks < 1)
+		throw Exception("ERROR: An infinite board must keep at least one chunk in memory.");
+
+	m_spillFile = (spillPath != nullptr) ? fopen(spillPath, "w+b") : tmpfile();
+
+	if (m_spillFile == nullptr)
+		throw Exception("ERROR: Cannot create the chunk spill file.");
+
+	m_threshold = static_cast<uint64_t>(density * 4294967296.0);
+}
+
+/**********************************************************************
+* Purpose:
+*	To close the spill file and destroy the board.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The spill file is closed (and deleted if it was temporary).
+**********************************************************************/
+InfiniteBoard::~InfiniteBoard()
+{
+	if (m_spillFile != nullptr)
+		fclose(m_spillFile);
+
+	m_spillFile = nullptr;
+}
+
+/**********************************************************************
+* Purpose:
+*	To uncover a cell on the board, unless it is already uncovered or
+*	has a flag. A cell w/zero adjacent mines uncovers its whole
+*	region, across as many chunks as it spans.
+*
+* Precondition:
+*	Two integers specifying the row and column pair to uncover.
+*
+* Postcondition:
+*	The specified cell is uncovered only if it is a valid cell to
+*	uncover. The result tells whether the move was illegal or hit a
+*	mine, and how many cells were uncovered.
+**********************************************************************/
+MoveResult InfiniteBoard::TryUncover(int row, int column)
+{
+	MoveResult result = { MOVE_OK, 0 };
+	int bit;
+	Chunk & chunk = GetChunk(row, column, bit);
+	int localRow = bit >> CHUNK_SHIFT;
+	uint64_t mask = 1ull << (bit & (CHUNK_SIZE - 1));
+
+	//If cell cannot be uncovered
+	if (chunk.uncovered[localRow] & mask)
+		result.status = MOVE_ALREADY_UNCOVERED;
+	else if (chunk.flagged[localRow] & mask)
+		result.status = MOVE_FLAGGED;
+	//Else if cell has no adjacent mines (& isn't one)
+	else if (!(chunk.mines[localRow] & mask) && chunk.counts[bit] == 0)
+		result.revealed = FloodFill(row, column);
+	else
+	{
+		chunk.uncovered[localRow] |= mask;
+		chunk.changed = true;
+		m_numUncovered++;
+		result.revealed = 1;
+
+		if (chunk.mines[localRow] & mask)
+			result.status = MOVE_HIT_MINE;
+	}
+
+	return result;
+}
+
+/**********************************************************************
+* Purpose:
+*	To add a flag to a cell on the board, unless it already has a
+*	flag or is uncovered.
+*
+* Precondition:
+*	Two integers specifying the row and column pair to add the flag to.
+*
+* Postcondition:
+*	A flag is added to the specified cell only if it is a valid cell
+*	to add a flag to. The result tells whether the move was illegal.
+**********************************************************************/
+MoveResult InfiniteBoard::TryFlag(int row, int column)
+{
+	MoveResult result = { MOVE_OK, 0 };
+	int bit;
+	Chunk & chunk = GetChunk(row, column, bit);
+	int localRow = bit >> CHUNK_SHIFT;
+	uint64_t mask = 1ull << (bit & (CHUNK_SIZE - 1));
+
+	if (chunk.uncovered[localRow] & mask)
+		result.status = MOVE_ALREADY_UNCOVERED;
+	else if (chunk.flagged[localRow] & mask)
+		result.status = MOVE_FLAGGED;
+	else
+	{
+		chunk.flagged[localRow] |= mask;
+		chunk.changed = true;
+		m_numFlags++;
+	}
+
+	return result;
+}
+
+/**********************************************************************
+* Purpose:
+*	To remove a flag from a cell on the board, if it has one.
+*
+* Precondition:
+*	Two integers specifying the row and column pair to remove the
+*	flag from.
+*
+* Postcondition:
+*	The flag is removed only if the cell has one. The result tells
+*	whether the move was illegal.
+**********************************************************************/
+MoveResult InfiniteBoard::TryUnflag(int row, int column)
+{
+	MoveResult result = { MOVE_OK, 0 };
+	int bit;
+	Chunk & chunk = GetChunk(row, column, bit);
+	int localRow = bit >> CHUNK_SHIFT;
+	uint64_t mask = 1ull << (bit & (CHUNK_SIZE - 1));
+
+	if (!(chunk.flagged[localRow] & mask))
+		result.status = MOVE_NOT_FLAGGED;
+	else
+	{
+		chunk.flagged[localRow] &= ~mask;
+		chunk.changed = true;
+		m_numFlags--;
+	}
+
+	return result;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the state of a cell.
+*
+* Precondition:
+*	Two integers specifying a row and column pair.
+*
+* Postcondition:
+*	The state of the cell is returned. Its chunk is in memory.
+**********************************************************************/
+State InfiniteBoard::GetCellState(int row, int column)
+{
+	int bit;
+	Chunk & chunk = GetChunk(row, column, bit);
+	uint64_t mask = 1ull << (bit & (CHUNK_SIZE - 1));
+
+	if (chunk.uncovered[bit >> CHUNK_SHIFT] & mask)
+		return UNCOVERED;
+	if (chunk.flagged[bit >> CHUNK_SHIFT] & mask)
+		return FLAGGED;
+	return COVERED;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the value of a cell.
+*
+* Precondition:
+*	Two integers specifying a row and column pair.
+*
+* Postcondition:
+*	MINE, or the # adjacent mines, is returned. The cell's chunk is
+*	in memory.
+**********************************************************************/
+Value InfiniteBoard::GetCellValue(int row, int column)
+{
+	int bit;
+	Chunk & chunk = GetChunk(row, column, bit);
+
+	if (chunk.mines[bit >> CHUNK_SHIFT] & (1ull << (bit & (CHUNK_SIZE - 1))))
+		return MINE;
+	return static_cast<Value>(chunk.counts[bit]);
+}
+
+/**********************************************************************
+* Purpose:
+*	To check if a cell contains a mine, straight from the generator.
+*
+* Precondition:
+*	Two integers specifying a row and column pair.
+*
+* Postcondition:
+*	A bool specifying whether the cell has a mine is returned. No
+*	chunk is made or dropped.
+**********************************************************************/
+bool InfiniteBoard::IsMine(int row, int column) const
+{
+	int localRow = row & (CHUNK_SIZE - 1);
+	int localColumn = column & (CHUNK_SIZE - 1);
+	uint64_t mines[CHUNK_SIZE];		//Only the cell's row is made
+
+	GenerateMines(row >> CHUNK_SHIFT, column >> CHUNK_SHIFT, localRow, localRow + 1,
+		localColumn, localColumn + 1, mines);
+
+	return mines[localRow] != 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the seed the mines come from.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The seed is returned.
+**********************************************************************/
+uint64_t InfiniteBoard::GetSeed() const
+{
+	return m_seed;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the # cells uncovered so far.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The # uncovered cells is returned.
+**********************************************************************/
+long long InfiniteBoard::GetUncoveredCount() const
+{
+	return m_numUncovered;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the # cells flagged.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The # flagged cells is returned.
+**********************************************************************/
+long long InfiniteBoard::GetFlagCount() const
+{
+	return m_numFlags;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the # chunks in memory.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The # chunks in memory is returned.
+**********************************************************************/
+int InfiniteBoard::GetResidentChunkCount() const
+{
+	return m_numResident;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the # chunks whose states are in the spill file.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The # spilled chunks is returned.
+**********************************************************************/
+int InfiniteBoard::GetSpilledChunkCount() const
+{
+	return static_cast<int>(m_spilled.size());
+}
+
+/**********************************************************************
+* Purpose:
+*	To find the slot of a chunk, making it if it isn't in memory. If
+*	every slot is in use, the least recently used chunk is dropped.
+*
+* Precondition:
+*	Two integers specifying a chunk row and column pair.
+*
+* Postcondition:
+*	The chunk is in memory and the most recently used, and its slot
+*	is returned. Any other chunk's slot may have been reused.
+**********************************************************************/
+int InfiniteBoard::FindChunk(int chunkRow, int chunkColumn)
+{
+	long long key = ChunkKey(chunkRow, chunkColumn);
+	int slot;
+
+	//Most moves stay in the chunk used last
+	if (m_newest >= 0 && m_chunks(m_newest).key == key)
+		return m_newest;
+
+	std::unordered_map<long long, int>::iterator found = m_slots.find(key);
+
+	if (found != m_slots.end())
+	{
+		slot = found->second;
+		Unlink(slot);
+	}
+	//Take a free slot (growing the slots up to the limit)...
+	else if (m_numResident < m_maxChunks)
+	{
+		if (m_numResident == m_chunks.getLength())
+			m_chunks.setLength(std::min(std::max(m_numResident * 2, INITIAL_CHUNK_SLOTS), m_maxChunks));
+
+		//Slot is only in use once its chunk is made
+		MakeChunk(m_chunks(m_numResident), chunkRow, chunkColumn);
+		slot = m_numResident++;
+		m_slots[key] = slot;
+	}
+	//...or the least recently used chunk's, once the new one is made
+	else
+	{
+		MakeChunk(m_spare, chunkRow, chunkColumn);
+
+		slot = m_oldest;
+		DropChunk(slot);
+		Unlink(slot);
+
+		m_chunks(slot) = m_spare;
+		m_slots[key] = slot;
+	}
+
+	LinkFirst(slot);
+
+	return slot;
+}
+
+/**********************************************************************
+* Purpose:
+*	To fill a chunk's data: its mines from the generator, its
+*	adjacency counts from those mines and the edge mines of the eight
+*	chunks around it, and its states from the spill file if it was
+*	spilled (or all covered if not).
+*
+* Precondition:
+*	The chunk to fill, not in use, and two integers specifying a chunk
+*	row and column pair.
+*
+* Postcondition:
+*	The chunk holds the data of the chunk at that pair, unchanged
+*	since the spill file. If the spill file can't be read, an
+*	Exception is thrown.
+**********************************************************************/
+void InfiniteBoard::MakeChunk(Chunk & chunk, int chunkRow, int chunkColumn)
+{
+	const int LAST = CHUNK_SIZE - 1;
+	uint64_t above[CHUNK_SIZE];		//Mines of the chunks above, by row
+	uint64_t level[CHUNK_SIZE];		//Mines of the chunks level w/it
+	uint64_t below[CHUNK_SIZE];		//Mines of the chunks below
+	uint8_t plane[CHUNK_STRIDE * CHUNK_STRIDE];	//Mines w/a ring of edge mines
+
+	chunk.key = ChunkKey(chunkRow, chunkColumn);
+	chunk.changed = false;
+	GenerateMines(chunkRow, chunkColumn, 0, CHUNK_SIZE, 0, CHUNK_SIZE, chunk.mines);
+
+	//Ring around the chunk: last row above, first row below, and the
+	//facing columns (& corners) of the chunks beside them
+	memset(plane, 0, sizeof(plane));
+
+	for (int dc = -1; dc <= 1; dc++)
+	{
+		int firstColumn = (dc < 0) ? LAST : 0;
+		int endColumn = (dc > 0) ? 1 : CHUNK_SIZE;
+
+		GenerateMines(chunkRow - 1, chunkColumn + dc, LAST, CHUNK_SIZE, firstColumn, endColumn, above);
+		GenerateMines(chunkRow + 1, chunkColumn + dc, 0, 1, firstColumn, endColumn, below);
+
+		if (dc != 0)
+			GenerateMines(chunkRow, chunkColumn + dc, 0, CHUNK_SIZE, firstColumn, endColumn, level);
+
+		//Column of the plane the chunk's column 0 (or its neighbor's) goes to
+		int offset = 1 + dc * CHUNK_SIZE;
+
+		for (int j = firstColumn; j < endColumn; j++)
+		{
+			plane[offset + j] = static_cast<uint8_t>((above[LAST] >> j) & 1);
+			plane[(CHUNK_STRIDE - 1) * CHUNK_STRIDE + offset + j] = static_cast<uint8_t>((below[0] >> j) & 1);
+
+			for (int i = 0; dc != 0 && i < CHUNK_SIZE; i++)
+				plane[(i + 1) * CHUNK_STRIDE + offset + j] = static_cast<uint8_t>((level[i] >> j) & 1);
+		}
+	}
+
+	for (int i = 0; i < CHUNK_SIZE; i++)
+	{
+		for (int j = 0; j < CHUNK_SIZE; j++)
+			plane[(i + 1) * CHUNK_STRIDE + 1 + j] = static_cast<uint8_t>((chunk.mines[i] >> j) & 1);
+	}
+
+	CountAdjacentMines(plane + CHUNK_STRIDE + 1, CHUNK_STRIDE, CHUNK_SIZE, CHUNK_SIZE, chunk.counts);
+
+	//States come back from the spill file, if the chunk was spilled
+	std::unordered_map<long long, long long>::iterator spilled = m_spilled.find(chunk.key);
+
+	if (spilled == m_spilled.end())
+	{
+		memset(chunk.uncovered, 0, sizeof(chunk.uncovered));
+		memset(chunk.flagged, 0, sizeof(chunk.flagged));
+	}
+	else if (SEEK_SPILL(m_spillFile, spilled->second) != 0 ||
+		fread(chunk.uncovered, sizeof(chunk.uncovered), 1, m_spillFile) != 1 ||
+		fread(chunk.flagged, sizeof(chunk.flagged), 1, m_spillFile) != 1)
+		throw Exception("ERROR: Cannot read a chunk from the spill file.");
+}
+
+/**********************************************************************
+* Purpose:
+*	To take a chunk out of memory. Its states are written to the
+*	spill file if they changed since it was made, in the chunk's
+*	place in the file if it has one.
+*
+* Precondition:
+*	The slot of a chunk in memory.
+*
+* Postcondition:
+*	The chunk is no longer in memory, and the spill file holds its
+*	states if any cell of it was ever uncovered or flagged.
+**********************************************************************/
+void InfiniteBoard::DropChunk(int slot)
+{
+	Chunk & chunk = m_chunks(slot);
+
+	if (chunk.changed)
+	{
+		std::unordered_map<long long, long long>::iterator spilled = m_spilled.find(chunk.key);
+		long long offset;
+
+		//New chunks go on the end of the file
+		if (spilled != m_spilled.end())
+			offset = spilled->second;
+		else
+		{
+			offset = m_spillEnd;
+			m_spillEnd += SPILL_RECORD_BYTES;
+			m_spilled[chunk.key] = offset;
+		}
+
+		if (SEEK_SPILL(m_spillFile, offset) != 0 ||
+			fwrite(chunk.uncovered, sizeof(chunk.uncovered), 1, m_spillFile) != 1 ||
+			fwrite(chunk.flagged, sizeof(chunk.flagged), 1, m_spillFile) != 1)
+			throw Exception("ERROR: Cannot write a chunk to the spill file.");
+	}
+
+	m_slots.erase(chunk.key);
+}
+
+/**********************************************************************
+* Purpose:
+*	To make the mines of a rectangle of a chunk. Each cell is a mine
+*	if its part of the Philox4x32 output for the counter (chunk, cell
+*	/ 4) falls below the density, so it only depends on the seed and
+*	where the cell is.
+*
+* Precondition:
+*	Two integers specifying a chunk row and column pair, the rows and
+*	columns of the rectangle ([firstRow, endRow) and [firstColumn,
+*	endColumn) inside the chunk), and the words to write, one per row
+*	of the chunk.
+*
+* Postcondition:
+*	mines[firstRow] to mines[endRow - 1] hold the rectangle's mine
+*	bits, w/the bits outside it cleared.
+**********************************************************************/
+void InfiniteBoard::GenerateMines(int chunkRow, int chunkColumn, int firstRow, int endRow,
+	int firstColumn, int endColumn, uint64_t * mines) const
+{
+	uint64_t counterHigh = ChunkKey(chunkRow, chunkColumn);
+	uint32_t random[4];
+
+	for (int i = firstRow; i < endRow; i++)
+	{
+		uint64_t word = 0;
+
+		//Each counter gives the numbers for four cells
+		for (int block = firstColumn / 4; block * 4 < endColumn; block++)
+		{
+			m_random.Generate(static_cast<uint64_t>(i * (CHUNK_SIZE / 4) + block), counterHigh, random);
+
+			for (int k = 0; k < 4; k++)
+			{
+				int j = block * 4 + k;
+
+				if (j >= firstColumn && j < endColumn && random[k] < m_threshold)
+					word |= 1ull << j;
+			}
+		}
+
+		mines[i] = word;
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To put a slot at the most recently used end of the order.
+*
+* Precondition:
+*	The slot of a chunk in memory that is not in the order.
+*
+* Postcondition:
+*	The slot is the most recently used.
+**********************************************************************/
+void InfiniteBoard::LinkFirst(int slot)
+{
+	Chunk & chunk = m_chunks(slot);
+
+	chunk.newer = -1;
+	chunk.older = m_newest;
+
+	if (m_newest >= 0)
+		m_chunks(m_newest).newer = slot;
+	else
+		m_oldest = slot;
+
+	m_newest = slot;
+}
+
+/**********************************************************************
+* Purpose:
+*	To take a slot out of the most to least recently used order.
+*
+* Precondition:
+*	The slot of a chunk in the order.
+*
+* Postcondition:
+*	The slot is not in the order; the slots around it are joined.
+**********************************************************************/
+void InfiniteBoard::Unlink(int slot)
+{
+	Chunk & chunk = m_chunks(slot);
+
+	if (chunk.newer >= 0)
+		m_chunks(chunk.newer).older = chunk.older;
+	else
+		m_newest = chunk.older;
+
+	if (chunk.older >= 0)
+		m_chunks(chunk.older).newer = chunk.newer;
+	else
+		m_oldest = chunk.newer;
+}
+
+/**********************************************************************
+* Purpose:
+*	To find the chunk holding a cell.
+*
+* Precondition:
+*	Two integers specifying a row and column pair, and where to put
+*	the cell's place in the chunk.
+*
+* Postcondition:
+*	The chunk is returned, valid until another chunk is found, and
+*	bit holds local row * CHUNK_SIZE + local column.
+**********************************************************************/
+InfiniteBoard::Chunk & InfiniteBoard::GetChunk(int row, int column, int & bit)
+{
+	bit = ((row & (CHUNK_SIZE - 1)) << CHUNK_SHIFT) | (column & (CHUNK_SIZE - 1));
+
+	return m_chunks(FindChunk(row >> CHUNK_SHIFT, column >> CHUNK_SHIFT));
+}
+
+/**********************************************************************
+* Purpose:
+*	To uncover the region around a cell w/zero adjacent mines: every
+*	zero cell connected to it (8-way) and the numbered cells around
+*	them, stopping at flags. Chunks are looked up again for every
+*	cell, since the region may span more chunks than fit in memory.
+*	The fill stops once it has uncovered MAX_FILL_CELLS cells, so one
+*	move never runs away on a huge region.
+*
+* Precondition:
+*	Two integers specifying the row and column pair of a covered,
+*	unflagged cell w/zero adjacent mines.
+*
+* Postcondition:
+*	The region, or the first MAX_FILL_CELLS cells of it, is uncovered,
+*	and the number of cells uncovered is returned.
+**********************************************************************/
+int InfiniteBoard::FloodFill(int row, int column)
+{
+	CellCoord cell = { row, column };
+	int revealed = 0;
+	int bit;
+
+	//Uncover the first cell before it's pushed, like every other
+	Chunk & first = GetChunk(row, column, bit);
+	first.uncovered[bit >> CHUNK_SHIFT] |= 1ull << (bit & (CHUNK_SIZE - 1));
+	first.changed = true;
+	revealed++;
+
+	m_fillStack.Clear();
+	m_fillStack.Push(cell);
+
+	//Stop at the cap, leaving the rest of the region covered
+	while (!m_fillStack.isEmpty() && revealed < MAX_FILL_CELLS)
+	{
+		cell = m_fillStack.Pop();
+
+		for (int i = cell.row - 1; i <= cell.row + 1 && revealed < MAX_FILL_CELLS; i++)
+		{
+			for (int j = cell.column - 1; j <= cell.column + 1 && revealed < MAX_FILL_CELLS; j++)
+			{
+				Chunk & chunk = GetChunk(i, j, bit);
+				int localRow = bit >> CHUNK_SHIFT;
+				uint64_t mask = 1ull << (bit & (CHUNK_SIZE - 1));
+
+				//If neighbor is uncovered or flagged, leave it
+				if ((chunk.uncovered[localRow] | chunk.flagged[localRow]) & mask)
+					continue;
+
+				chunk.uncovered[localRow] |= mask;
+				chunk.changed = true;
+				revealed++;
+
+				//If neighbor is a zero cell too, spread from it
+				if (chunk.counts[bit] == 0)
+				{
+					CellCoord next = { i, j };
+					m_fillStack.Push(next);
+				}
+			}
+		}
+	}
+
+	m_numUncovered += revealed;
+
+	return revealed;
+}
@@ -0,0 +1,225 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			infiniteboard.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: InfiniteBoard
+*
+* Purpose:
+*	This class is a Minesweeper board w/no edges, for bots and long
+*	running play. Any int row and column pair is a cell. The board is
+*	a sparse map of CHUNK_SIZE square chunks, made the first time one
+*	of their cells is touched: a chunk's mines come from a
+*	counter-based generator keyed by the seed and the chunk's place,
+*	and its adjacency counts from those mines and the edge mines of
+*	the chunks around it, which are made the same way. Nothing is
+*	allocated up front: the slots chunks are kept in grow (doubling)
+*	as chunks are made, up to the limit.
+*
+*	At most a set # of chunks are kept in memory. When another is
+*	needed, the least recently used chunk is dropped; if any of its
+*	cells were uncovered or flagged, their states are spilled to a
+*	file first and read back the next time the chunk is needed.
+*	Unchanged chunks are just made again.
+*
+* Manager functions:
+*	InfiniteBoard(uint64_t seed, double density,
+*				  int maxChunks = DEFAULT_MAX_CHUNKS,
+*				  const char * spillPath = nullptr)
+*		Creates a board whose cells are mines w/the given density,
+*		keeping at most maxChunks chunks in memory and spilling
+*		changed chunks to the file at spillPath (a temporary file by
+*		default). Throws an Exception if the density is below
+*		MIN_INFINITE_DENSITY, or no chunk fits.
+*
+*	~InfiniteBoard()
+*		Closes the spill file.
+*
+*	A board owns its spill file, so it cannot be copied.
+*
+* Methods:
+*	MoveResult TryUncover(int row, int column)
+*		Marks the cell given by the row and column pair as uncovered,
+*		flood filling zero regions across chunks. Returns whether the
+*		move was legal or hit a mine, and how many cells it uncovered.
+*		Never wins or throws (except when the spill file fails). A
+*		fill stops after MAX_FILL_CELLS cells; uncovering a covered
+*		cell at the edge of what it reached carries on from there.
+*
+*	MoveResult TryFlag(int row, int column)
+*	MoveResult TryUnflag(int row, int column)
+*		Add or remove a flag on the cell given by the row and column
+*		pair.
+*
+*	State GetCellState(int row, int column)
+*	Value GetCellValue(int row, int column)
+*		Return the state and value of the cell given by the row and
+*		column pair, making its chunk if needed.
+*
+*	bool IsMine(int row, int column) const
+*		Checks if the cell given by the row and column pair contains
+*		a mine, w/o making its chunk.
+*
+*	uint64_t GetSeed() const
+*		Returns the seed the mines come from.
+*
+*	long long GetUncoveredCount() const
+*	long long GetFlagCount() const
+*		Return the # cells uncovered and flagged so far.
+*
+*	int GetResidentChunkCount() const
+*	int GetSpilledChunkCount() const
+*		Return the # chunks in memory and in the spill file.
+*
+*	int FindChunk(int chunkRow, int chunkColumn)
+*		Returns the slot of a chunk, making or reloading it (and
+*		dropping the least recently used chunk) if it isn't in memory.
+*		A slot is only taken once its chunk is made, so a failed
+*		reload leaves the cache as it was.
+*
+*	void MakeChunk(Chunk & chunk, int chunkRow, int chunkColumn)
+*		Fills a chunk w/its mines, adjacency counts, and states.
+*
+*	void DropChunk(int slot)
+*		Takes a chunk out of memory, spilling its states if changed.
+*
+*	void GenerateMines(int chunkRow, int chunkColumn, int firstRow,
+*					   int endRow, int firstColumn, int endColumn,
+*					   uint64_t * mines) const
+*		Makes the mines of part of a chunk, one word per row.
+*
+*	void LinkFirst(int slot)
+*	void Unlink(int slot)
+*		Keep the chunks in memory in most to least recently used
+*		order.
+*
+*	Chunk & GetChunk(int row, int column, int & bit)
+*		Returns the chunk holding a cell, and the cell's place in it.
+*
+*	int FloodFill(int row, int column)
+*		Uncovers the region around the given zero cell, up to
+*		MAX_FILL_CELLS cells. Returns the number of cells uncovered.
+**********************************************************************/
+
+#ifndef INFINITEBOARD_H
+#define INFINITEBOARD_H
+
+#include "board.h"
+#include "random.h"
+
+#include <cstdio>
+#include <unordered_map>
+
+//Chunks are 2^CHUNK_SHIFT cells on a side, one 64-bit word per row
+const int CHUNK_SHIFT = 6;
+const int CHUNK_SIZE = 1 << CHUNK_SHIFT;
+
+//# chunks an InfiniteBoard keeps in memory unless told otherwise
+const int DEFAULT_MAX_CHUNKS = 4096;
+
+//# chunk slots allocated when the first chunk is made
+const int INITIAL_CHUNK_SLOTS = 16;
+
+//Lowest mine density an InfiniteBoard takes. A margin picked by hand,
+//not a proven bound: the lower the density, the larger zero regions
+//get, and just above it they can still be huge.
+const double MIN_INFINITE_DENSITY = 0.12;
+
+//Most cells one move's flood fill uncovers, so a bot can't stall on one
+//enormous zero region
+const int MAX_FILL_CELLS = 1 << 20;
+
+class InfiniteBoard
+{
+	public:
+		//4-arg Ctor
+		InfiniteBoard(uint64_t seed, double density, int maxChunks = DEFAULT_MAX_CHUNKS,
+			const char * spillPath = nullptr);
+
+		//Default Dtor
+		~InfiniteBoard();
+
+		//Make a move, reporting illegal moves in the result
+		MoveResult TryUncover(int row, int column);
+		MoveResult TryFlag(int row, int column);
+		MoveResult TryUnflag(int row, int column);
+
+		//Read a cell, making its chunk if needed
+		State GetCellState(int row, int column);
+		Value GetCellValue(int row, int column);
+
+		//Check if a cell contains a mine
+		bool IsMine(int row, int column) const;
+
+		//Seed the mines come from
+		uint64_t GetSeed() const;
+
+		//Game state for display
+		long long GetUncoveredCount() const;
+		long long GetFlagCount() const;
+
+		//Chunk cache use
+		int GetResidentChunkCount() const;
+		int GetSpilledChunkCount() const;
+
+	private:
+		//Boards own their spill file, so they cannot be copied
+		InfiniteBoard(const InfiniteBoard & copy);
+		InfiniteBoard & operator=(const InfiniteBoard & rhs);
+
+		//A chunk in memory
+		struct Chunk
+		{
+			long long key;		//Chunk row & column packed by ChunkKey()
+			uint64_t mines[CHUNK_SIZE];		//Mine bits, one word per row
+			uint64_t uncovered[CHUNK_SIZE];	//Uncovered bits
+			uint64_t flagged[CHUNK_SIZE];	//Flagged bits
+			uint8_t counts[CHUNK_SIZE * CHUNK_SIZE];	//# adjacent mines
+			bool changed;		//Whether states differ from the spill file
+			int newer;			//Slot used more recently, -1 if none
+			int older;			//Slot used less recently, -1 if none
+		};
+
+		//Slot of a chunk, made or reloaded if needed
+		int FindChunk(int chunkRow, int chunkColumn);
+
+		//Fill a chunk's data
+		void MakeChunk(Chunk & chunk, int chunkRow, int chunkColumn);
+
+		//Take a chunk out of memory
+		void DropChunk(int slot);
+
+		//Mines of part of a chunk
+		void GenerateMines(int chunkRow, int chunkColumn, int firstRow, int endRow,
+			int firstColumn, int endColumn, uint64_t * mines) const;
+
+		//Most to least recently used order
+		void LinkFirst(int slot);
+		void Unlink(int slot);
+
+		//Chunk holding a cell
+		Chunk & GetChunk(int row, int column, int & bit);
+
+		//Uncover a zero cell's region
+		int FloodFill(int row, int column);
+
+		uint64_t m_seed;			//Seed the mines come from
+		Philox4x32 m_random;		//Generator keyed by the seed
+		uint64_t m_threshold;		//Mine density, as a fraction of 2^32
+		Array<Chunk> m_chunks;		//Slots for the chunks in memory
+		Chunk m_spare;				//Chunk made before it replaces the least recently used
+		int m_maxChunks;			//Most slots m_chunks may grow to
+		int m_numResident;			//# slots in use
+		int m_newest;				//Most recently used slot, -1 if none
+		int m_oldest;				//Least recently used slot, -1 if none
+		std::unordered_map<long long, int> m_slots;		//Slot of each chunk in memory
+		std::unordered_map<long long, long long> m_spilled;	//File offset of each spilled chunk
+		FILE * m_spillFile;			//Where changed chunks go
+		long long m_spillEnd;		//End of the spill file
+		long long m_numUncovered;	//# uncovered cells
+		long long m_numFlags;		//# flagged cells
+		Stack<CellCoord> m_fillStack;	//Work stack reused by FloodFill
+};
+
+#endif //INFINITEBOARD_H
@@ -0,0 +1,438 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			memoryresource.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "memoryresource.h"
+
+#include <cstdlib>
+using std::malloc;
+using std::calloc;
+using std::realloc;
+using std::free;
+#include <cstring>
+using std::memset;
+using std::memcpy;
+#include <cstdint>
+#include <new>
+
+//Strictest alignment malloc guarantees
+static const size_t MAX_ALIGN = alignof(std::max_align_t);
+
+/**********************************************************************
+* Purpose:
+*	To round a size up to a multiple of an alignment.
+*
+* Precondition:
+*	A size and a power-of-two alignment.
+*
+* Postcondition:
+*	The smallest multiple of the alignment not below the size is
+*	returned.
+**********************************************************************/
+static size_t AlignUp(size_t bytes, size_t alignment)
+{
+	return (bytes + alignment - 1) & ~(alignment - 1);
+}
+
+/**********************************************************************
+* Purpose:
+*	To destroy a MemoryResource.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The MemoryResource is destroyed.
+**********************************************************************/
+MemoryResource::~MemoryResource()
+{}
+
+/**********************************************************************
+* Purpose:
+*	To get storage with every byte set to zero. Resources that can get
+*	zeroed storage more cheaply than Allocate() and memset() override
+*	this.
+*
+* Precondition:
+*	The size and alignment of the storage.
+*
+* Postcondition:
+*	Zeroed storage is returned.
+**********************************************************************/
+void * MemoryResource::AllocateZeroed(size_t bytes, size_t alignment)
+{
+	void * memory = Allocate(bytes, alignment);
+	memset(memory, 0, bytes);
+
+	return memory;
+}
+
+/**********************************************************************
+* Purpose:
+*	To change the size of storage while keeping its contents.
+*	Resources that can grow storage in place override this.
+*
+* Precondition:
+*	Storage from this resource (or nullptr), its old size, and the
+*	new size and alignment.
+*
+* Postcondition:
+*	Storage of the new size starting with the old contents is
+*	returned, and the old storage is given back.
+**********************************************************************/
+void * MemoryResource::Reallocate(void * memory, size_t oldBytes, size_t bytes, size_t alignment)
+{
+	void * newMemory = Allocate(bytes, alignment);
+
+	if (memory != nullptr)
+	{
+		memcpy(newMemory, memory, (oldBytes < bytes) ? oldBytes : bytes);
+		Deallocate(memory, oldBytes, alignment);
+	}
+
+	return newMemory;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the resource backed by the global heap, which every
+*	Array uses unless it is given another one.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The shared HeapResource is returned.
+**********************************************************************/
+MemoryResource * MemoryResource::GetDefault()
+{
+	static HeapResource heap;
+
+	return &heap;
+}
+
+/**********************************************************************
+* Purpose:
+*	To get storage from malloc.
+*
+* Precondition:
+*	The size of the storage and an alignment no stricter than malloc
+*	guarantees.
+*
+* Postcondition:
+*	Uninitialized storage is returned, or std::bad_alloc is thrown.
+**********************************************************************/
+void * HeapResource::Allocate(size_t bytes, size_t)
+{
+	void * memory = malloc(bytes > 0 ? bytes : 1);
+
+	if (memory == nullptr)
+		throw std::bad_alloc();
+
+	return memory;
+}
+
+/**********************************************************************
+* Purpose:
+*	To give storage back to free.
+*
+* Precondition:
+*	Storage from this resource, or nullptr.
+*
+* Postcondition:
+*	The storage is freed.
+**********************************************************************/
+void HeapResource::Deallocate(void * memory, size_t, size_t)
+{
+	free(memory);
+}
+
+/**********************************************************************
+* Purpose:
+*	To get zeroed storage from calloc, which can hand out fresh zero
+*	pages without touching them.
+*
+* Precondition:
+*	The size of the storage and an alignment no stricter than malloc
+*	guarantees.
+*
+* Postcondition:
+*	Zeroed storage is returned, or std::bad_alloc is thrown.
+**********************************************************************/
+void * HeapResource::AllocateZeroed(size_t bytes, size_t)
+{
+	void * memory = calloc(bytes > 0 ? bytes : 1, 1);
+
+	if (memory == nullptr)
+		throw std::bad_alloc();
+
+	return memory;
+}
+
+/**********************************************************************
+* Purpose:
+*	To change the size of storage with realloc, which can often grow
+*	it in place.
+*
+* Precondition:
+*	Storage from this resource (or nullptr) and the new size.
+*
+* Postcondition:
+*	Storage of the new size starting with the old contents is
+*	returned, or std::bad_alloc is thrown and the old storage is left
+*	alone.
+**********************************************************************/
+void * HeapResource::Reallocate(void * memory, size_t, size_t bytes, size_t)
+{
+	void * newMemory = realloc(memory, bytes > 0 ? bytes : 1);
+
+	if (newMemory == nullptr)
+		throw std::bad_alloc();
+
+	return newMemory;
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct an empty MonotonicArena.
+*
+* Precondition:
+*	The size of the first chunk to take, and the resource to take
+*	chunks from (nullptr for the heap).
+*
+* Postcondition:
+*	The arena is empty; the first Allocate() takes the first chunk.
+**********************************************************************/
+MonotonicArena::MonotonicArena(size_t chunkBytes, MemoryResource * upstream) :
+	m_upstream(upstream != nullptr ? upstream : GetDefault()), m_chunks(nullptr),
+	m_current(nullptr), m_end(nullptr), m_chunkBytes(chunkBytes > 0 ? chunkBytes : DEFAULT_CHUNK_BYTES)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To give back every chunk and destroy the MonotonicArena.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Every chunk is given back to the upstream resource.
+**********************************************************************/
+MonotonicArena::~MonotonicArena()
+{
+	Release();
+}
+
+/**********************************************************************
+* Purpose:
+*	To hand out storage from the current chunk, taking a new chunk
+*	from upstream when the current one is full. Each new chunk is
+*	twice the size of the last, so the number of chunks grows only
+*	logarithmically.
+*
+* Precondition:
+*	The size of the storage and a power-of-two alignment.
+*
+* Postcondition:
+*	Uninitialized storage is returned.
+**********************************************************************/
+void * MonotonicArena::Allocate(size_t bytes, size_t alignment)
+{
+	uintptr_t current = reinterpret_cast<uintptr_t>(m_current);
+	uintptr_t aligned = AlignUp(current, alignment);
+
+	//If the current chunk cannot fit the request, take a new one
+	if (m_current == nullptr || aligned + bytes > reinterpret_cast<uintptr_t>(m_end))
+	{
+		size_t header = AlignUp(sizeof(Chunk), MAX_ALIGN);
+		size_t chunkBytes = header + bytes + alignment;
+
+		if (chunkBytes < m_chunkBytes)
+			chunkBytes = m_chunkBytes;
+
+		Chunk * chunk = static_cast<Chunk *>(m_upstream->Allocate(chunkBytes, MAX_ALIGN));
+		chunk->next = m_chunks;
+		chunk->bytes = chunkBytes;
+		m_chunks = chunk;
+
+		m_current = reinterpret_cast<char *>(chunk) + header;
+		m_end = reinterpret_cast<char *>(chunk) + chunkBytes;
+		m_chunkBytes *= 2;
+
+		aligned = AlignUp(reinterpret_cast<uintptr_t>(m_current), alignment);
+	}
+
+	m_current = reinterpret_cast<char *>(aligned + bytes);
+
+	return reinterpret_cast<void *>(aligned);
+}
+
+/**********************************************************************
+* Purpose:
+*	To accept storage back. An arena only gives storage back all at
+*	once, in Release().
+*
+* Precondition:
+*	Storage from this arena.
+*
+* Postcondition:
+*	<None>
+**********************************************************************/
+void MonotonicArena::Deallocate(void *, size_t, size_t)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To give back every chunk the arena has taken.
+*
+* Precondition:
+*	Nothing still uses storage from this arena.
+*
+* Postcondition:
+*	Every chunk is given back and the arena is empty.
+**********************************************************************/
+void MonotonicArena::Release()
+{
+	while (m_chunks != nullptr)
+	{
+		Chunk * next = m_chunks->next;
+		m_upstream->Deallocate(m_chunks, m_chunks->bytes, MAX_ALIGN);
+		m_chunks = next;
+	}
+
+	m_current = nullptr;
+	m_end = nullptr;
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct an empty BlockPool. The block size is rounded up so
+*	every block is aligned for any element type.
+*
+* Precondition:
+*	The size of each block, the number of blocks to take from upstream
+*	at a time, and the resource to take them from (nullptr for the
+*	heap).
+*
+* Postcondition:
+*	The pool is empty; the first Allocate() takes the first chunk.
+**********************************************************************/
+BlockPool::BlockPool(size_t blockBytes, int blocksPerChunk, MemoryResource * upstream) :
+	m_upstream(upstream != nullptr ? upstream : GetDefault()), m_freeBlocks(nullptr),
+	m_chunks(nullptr), m_blockBytes(AlignUp(blockBytes > sizeof(Link) ? blockBytes : sizeof(Link), MAX_ALIGN)),
+	m_blocksPerChunk(blocksPerChunk > 0 ? blocksPerChunk : 1)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To give back every chunk and destroy the BlockPool.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Every chunk is given back to the upstream resource.
+**********************************************************************/
+BlockPool::~BlockPool()
+{
+	Release();
+}
+
+/**********************************************************************
+* Purpose:
+*	To hand out a block from the free list, taking a new chunk of
+*	blocks from upstream when the list is empty. Requests that do not
+*	fit in a block go straight to upstream.
+*
+* Precondition:
+*	The size of the storage and a power-of-two alignment.
+*
+* Postcondition:
+*	Uninitialized storage is returned.
+**********************************************************************/
+void * BlockPool::Allocate(size_t bytes, size_t alignment)
+{
+	//Too big for a block
+	if (bytes > m_blockBytes || alignment > MAX_ALIGN)
+		return m_upstream->Allocate(bytes, alignment);
+
+	//If no free blocks are left, carve a new chunk into blocks
+	if (m_freeBlocks == nullptr)
+	{
+		size_t header = AlignUp(sizeof(Link), MAX_ALIGN);
+		size_t chunkBytes = header + m_blockBytes * m_blocksPerChunk;
+		char * chunk = static_cast<char *>(m_upstream->Allocate(chunkBytes, MAX_ALIGN));
+
+		Link * chunkLink = reinterpret_cast<Link *>(chunk);
+		chunkLink->next = m_chunks;
+		m_chunks = chunkLink;
+
+		for (int i = m_blocksPerChunk - 1; i >= 0; i--)
+		{
+			Link * block = reinterpret_cast<Link *>(chunk + header + i * m_blockBytes);
+			block->next = m_freeBlocks;
+			m_freeBlocks = block;
+		}
+	}
+
+	Link * block = m_freeBlocks;
+	m_freeBlocks = block->next;
+
+	return block;
+}
+
+/**********************************************************************
+* Purpose:
+*	To put a block back on the free list, or give storage that did
+*	not fit in a block back to upstream.
+*
+* Precondition:
+*	Storage from this pool, with the size and alignment it was
+*	allocated with.
+*
+* Postcondition:
+*	The storage can be handed out again.
+**********************************************************************/
+void BlockPool::Deallocate(void * memory, size_t bytes, size_t alignment)
+{
+	if (memory == nullptr)
+		return;
+
+	//Came from upstream
+	if (bytes > m_blockBytes || alignment > MAX_ALIGN)
+	{
+		m_upstream->Deallocate(memory, bytes, alignment);
+		return;
+	}
+
+	Link * block = static_cast<Link *>(memory);
+	block->next = m_freeBlocks;
+	m_freeBlocks = block;
+}
+
+/**********************************************************************
+* Purpose:
+*	To give back every chunk the pool has taken.
+*
+* Precondition:
+*	Nothing still uses blocks from this pool.
+*
+* Postcondition:
+*	Every chunk is given back and the pool is empty.
+**********************************************************************/
+void BlockPool::Release()
+{
+	size_t chunkBytes = AlignUp(sizeof(Link), MAX_ALIGN) + m_blockBytes * m_blocksPerChunk;
+
+	while (m_chunks != nullptr)
+	{
+		Link * next = m_chunks->next;
+		m_upstream->Deallocate(m_chunks, chunkBytes, MAX_ALIGN);
+		m_chunks = next;
+	}
+
+	m_freeBlocks = nullptr;
+}
@@ -0,0 +1,187 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			memoryresource.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: MemoryResource
+*
+* Purpose:
+*	This abstract class is where an Array gets its storage from. It
+*	lets a Board draw all of its storage from an arena or a pool
+*	instead of the global heap.
+*
+* Methods:
+*	void * Allocate(size_t bytes, size_t alignment)
+*		Returns uninitialized storage of the given size.
+*
+*	void Deallocate(void * memory, size_t bytes, size_t alignment)
+*		Gives back storage returned by this resource.
+*
+*	void * AllocateZeroed(size_t bytes, size_t alignment)
+*		Returns storage with every byte set to zero.
+*
+*	void * Reallocate(void * memory, size_t oldBytes, size_t bytes,
+*					  size_t alignment)
+*		Returns storage of a new size that starts with the contents
+*		of the old storage, which is given back.
+*
+*	static MemoryResource * GetDefault()
+*		Returns the resource backed by the global heap.
+*
+* Class: HeapResource
+*
+* Purpose:
+*	Gets storage from malloc/calloc/realloc/free. Large calloc requests
+*	are typically served with fresh zero pages from the OS.
+*
+* Class: MonotonicArena
+*
+* Purpose:
+*	Hands out storage by bumping a pointer through large chunks taken
+*	from an upstream resource. Deallocate() does nothing; Release()
+*	gives back every chunk at once. An arena is not thread-safe, so
+*	each thread uses its own, which also means threads never contend
+*	on a shared heap lock.
+*
+* Manager functions:
+*	MonotonicArena(size_t chunkBytes = DEFAULT_CHUNK_BYTES,
+*				   MemoryResource * upstream = nullptr)
+*		Creates an arena that takes chunks of at least chunkBytes from
+*		upstream (the heap by default).
+*
+*	~MonotonicArena()
+*		Gives back every chunk.
+*
+* Methods:
+*	void Release()
+*		Gives back every chunk. All storage handed out so far becomes
+*		invalid.
+*
+* Class: BlockPool
+*
+* Purpose:
+*	Hands out fixed-size blocks from a free list, taking blocks from
+*	an upstream resource a chunk at a time. Requests larger than a
+*	block go straight to upstream. Like the arena, a pool is not
+*	thread-safe and is meant to be used by one thread.
+*
+* Manager functions:
+*	BlockPool(size_t blockBytes, int blocksPerChunk = 16,
+*			  MemoryResource * upstream = nullptr)
+*		Creates a pool of blocks of blockBytes each.
+*
+*	~BlockPool()
+*		Gives back every chunk.
+*
+* Methods:
+*	void Release()
+*		Gives back every chunk. All blocks handed out so far become
+*		invalid.
+**********************************************************************/
+
+#ifndef MEMORYRESOURCE_H
+#define MEMORYRESOURCE_H
+
+#include <cstddef>
+
+class MemoryResource
+{
+public:
+	//Virtual Dtor
+	virtual ~MemoryResource();
+
+	//Get & give back storage
+	virtual void * Allocate(size_t bytes, size_t alignment) = 0;
+	virtual void Deallocate(void * memory, size_t bytes, size_t alignment) = 0;
+
+	//Get storage that is already zeroed
+	virtual void * AllocateZeroed(size_t bytes, size_t alignment);
+
+	//Change the size of storage, keeping its contents
+	virtual void * Reallocate(void * memory, size_t oldBytes, size_t bytes, size_t alignment);
+
+	//Resource backed by the global heap
+	static MemoryResource * GetDefault();
+};
+
+class HeapResource : public MemoryResource
+{
+public:
+	void * Allocate(size_t bytes, size_t alignment);
+	void Deallocate(void * memory, size_t bytes, size_t alignment);
+	void * AllocateZeroed(size_t bytes, size_t alignment);
+	void * Reallocate(void * memory, size_t oldBytes, size_t bytes, size_t alignment);
+};
+
+class MonotonicArena : public MemoryResource
+{
+public:
+	//Size of chunks taken from upstream unless told otherwise
+	static const size_t DEFAULT_CHUNK_BYTES = 1 << 20;
+
+	//2-arg Ctor
+	explicit MonotonicArena(size_t chunkBytes = DEFAULT_CHUNK_BYTES, MemoryResource * upstream = nullptr);
+
+	//Default Dtor
+	~MonotonicArena();
+
+	void * Allocate(size_t bytes, size_t alignment);
+	void Deallocate(void * memory, size_t bytes, size_t alignment);
+
+	//Give back every chunk at once
+	void Release();
+
+private:
+	//Arenas own raw chunks, so they cannot be copied
+	MonotonicArena(const MonotonicArena & copy);
+	MonotonicArena & operator=(const MonotonicArena & rhs);
+
+	//Header at the start of each chunk
+	struct Chunk
+	{
+		Chunk * next;	//Chunk taken before this one
+		size_t bytes;	//Size of the chunk, header included
+	};
+
+	MemoryResource * m_upstream;	//Where chunks come from
+	Chunk * m_chunks;		//Most recent chunk
+	char * m_current;		//Next free byte in the current chunk
+	char * m_end;			//End of the current chunk
+	size_t m_chunkBytes;	//Size of the next chunk to take
+};
+
+class BlockPool : public MemoryResource
+{
+public:
+	//3-arg Ctor
+	explicit BlockPool(size_t blockBytes, int blocksPerChunk = 16, MemoryResource * upstream = nullptr);
+
+	//Default Dtor
+	~BlockPool();
+
+	void * Allocate(size_t bytes, size_t alignment);
+	void Deallocate(void * memory, size_t bytes, size_t alignment);
+
+	//Give back every chunk at once
+	void Release();
+
+private:
+	//Pools own raw chunks, so they cannot be copied
+	BlockPool(const BlockPool & copy);
+	BlockPool & operator=(const BlockPool & rhs);
+
+	//Free blocks and chunk headers are linked through their first bytes
+	struct Link
+	{
+		Link * next;
+	};
+
+	MemoryResource * m_upstream;	//Where chunks come from
+	Link * m_freeBlocks;	//Blocks ready to hand out
+	Link * m_chunks;		//Chunks taken from upstream
+	size_t m_blockBytes;	//Size of each block
+	int m_blocksPerChunk;	//# blocks taken from upstream at a time
+};
+
+#endif //MEMORYRESOURCE_H
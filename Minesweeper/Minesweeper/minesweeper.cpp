@@ -2,7 +2,7 @@
 * Author:			Molli Drivdahl
 * Filename:			minesweeper.cpp
 * Date Created:		1/12/16
-* Modifications:	1/17/16
+* Modifications:	10/17/26
 **********************************************************************/
 
 #include "minesweeper.h"
@@ -11,6 +11,9 @@
 using std::cout;
 using std::cin;
 
+//Lines left below the board for the action menu & its prompts
+const int PROMPT_LINES = 10;
+
 /**********************************************************************
 * Purpose:
 *	To construct an instance of a Minesweeper game and initialize the
@@ -22,10 +25,36 @@ using std::cin;
 *
 * Postcondition:
 *	Data member specifying the end of the game is initialized to
-*	default value of false.
+*	default value of false, and the first uncover of every game is
+*	safe.
 **********************************************************************/
-Minesweeper::Minesweeper() : m_endGame(false)
-{}
+Minesweeper::Minesweeper() : m_renderer(Renderer::GetDefault()), m_endGame(false)
+{
+	//Mines wait for the first uncover & stay off its area
+	m_gameBoard.SetFirstClick(FIRST_CLICK_OPENING);
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a Minesweeper game that shows its
+*	board w/the given renderer, e.g. a NullRenderer for automated
+*	play.
+*
+* Precondition:
+*	The renderer to draw the board w/(nullptr for the default ANSI
+*	terminal one). The renderer must outlive the Minesweeper.
+*
+* Postcondition:
+*	Data member specifying the end of the game is initialized to
+*	default value of false, and the first uncover of every game is
+*	safe.
+**********************************************************************/
+Minesweeper::Minesweeper(Renderer * renderer) :
+m_renderer(renderer != nullptr ? renderer : Renderer::GetDefault()), m_endGame(false)
+{
+	//Mines wait for the first uncover & stay off its area
+	m_gameBoard.SetFirstClick(FIRST_CLICK_OPENING);
+}
 
 /**********************************************************************
 * Purpose:
@@ -40,11 +69,31 @@ Minesweeper::Minesweeper() : m_endGame(false)
 *	The data members are initialized to the values of the data members
 *	of the existing Minesweeper object.
 **********************************************************************/
-Minesweeper::Minesweeper(const Minesweeper & copy) : m_endGame(false)
+Minesweeper::Minesweeper(const Minesweeper & copy) : m_renderer(copy.m_renderer),
+m_endGame(false)
 {
 	*this = copy;	//Use assignment operator
 }
 
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a Minesweeper by taking over the data of
+*	an expiring Minesweeper object instead of copying it.
+*
+* Precondition:
+*	An expiring Minesweeper object passed by rvalue ref.
+*
+* Postcondition:
+*	The data members hold the data of the expiring Minesweeper, which is
+*	left empty.
+**********************************************************************/
+Minesweeper::Minesweeper(Minesweeper && move) noexcept : m_gameBoard(std::move(move.m_gameBoard)),
+m_renderer(move.m_renderer), m_endGame(move.m_endGame)
+{
+	//Leave expiring Minesweeper at its default state
+	move.m_endGame = false;
+}
+
 /**********************************************************************
 * Purpose:
 *	To reset the data members to default values, and destroy the
@@ -81,12 +130,50 @@ Minesweeper & Minesweeper::operator=(const Minesweeper & rhs)
 	{
 		//Use Board's assignment operator
 		m_gameBoard = rhs.m_gameBoard;
+		m_renderer = rhs.m_renderer;	//Renderers are shared, not copied
 		m_endGame = rhs.m_endGame;
 	}
 
 	return *this;
 }
 
+/**********************************************************************
+* Purpose:
+*	To assign an expiring Minesweeper object to an existing Minesweeper object
+*	by taking over its data instead of copying it.
+*
+* Precondition:
+*	An expiring Minesweeper object passed by rvalue ref.
+*
+* Postcondition:
+*	The existing Minesweeper holds the data of the expiring Minesweeper, which
+*	is left holding the old data of the existing Minesweeper until it is
+*	destroyed.
+**********************************************************************/
+Minesweeper & Minesweeper::operator=(Minesweeper && rhs) noexcept
+{
+	swap(rhs);
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To exchange the data of two Minesweepers without copying any of it.
+*
+* Precondition:
+*	An existing Minesweeper object passed by ref.
+*
+* Postcondition:
+*	Each Minesweeper holds the data the other held before.
+**********************************************************************/
+void Minesweeper::swap(Minesweeper & other) noexcept
+{
+	m_gameBoard.swap(other.m_gameBoard);
+	std::swap(m_renderer, other.m_renderer);
+	std::swap(m_endGame, other.m_endGame);
+}
+
 /**********************************************************************
 * Purpose:
 *	To provide an entry point into the game and exit out of the game.
@@ -106,13 +193,13 @@ void Minesweeper::RunGame()
 	do
 	{
 		//Upon starting the game
-		system("cls");
+		m_renderer->ClearScreen();
 
 		cout << "\t\tWelcome to Minesweeper!\n\n";
 		cout << "Objective: Uncover all the cells that don't contain mines,\n"
 			<< "or flag all (and only) the cells that do contain mines.\n";
 		cout << "Game is lost if: A cell is uncovered that contains a mine.\n";
-		cout << "Warning: It is possible to lose on the first try to uncover a cell.\n\n";
+		cout << "The first cell uncovered never contains a mine.\n\n";
 
 		ChooseDifficulty();
 
@@ -122,6 +209,9 @@ void Minesweeper::RunGame()
 	}
 	while (playAgain == 'y');
 
+	//Give the terminal back its normal scrolling
+	m_renderer->RestoreTerminal();
+
 	cout << "\nThanks for playing!\n\n";
 }
 
@@ -144,15 +234,16 @@ void Minesweeper::ChooseDifficulty()
 	cout << "Please select the difficulty level:\n"
 		<< "1) Beginner\n"
 		<< "2) Intermediate\n"
-		<< "3) Expert\n\n";
+		<< "3) Expert\n"
+		<< "4) Custom\n\n";
 	cout << "Your choice: ";
 	cin >> choice;
 	cin.clear();
 	cin.ignore(cin.rdbuf()->in_avail());	//In case char goes into an int
 
-	while (choice < 1 || choice > 3)
+	while (choice < 1 || choice > 4)
 	{
-		cout << "\nChoice must be a number between 1 and 3. Please try again: ";
+		cout << "\nChoice must be a number between 1 and 4. Please try again: ";
 		cin >> choice;
 		cin.clear();
 		cin.ignore(cin.rdbuf()->in_avail());	//In case char goes into an int
@@ -187,12 +278,79 @@ void Minesweeper::InterpretDifficultyChoice(int choice)
 	case 3:
 		m_gameBoard.CreateBoard(MEDIUM_SIZE, LARGE_SIZE, EXPERT_MINES);
 		break;
+	case 4:
+		ChooseCustomBoard();
+		break;
 	}
 
 	//Run main game loop
 	GameLoop();
 }
 
+/**********************************************************************
+* Purpose:
+*	To create a game board of the user's specified size and number of
+*	mines.
+*
+* Precondition:
+*	User chooses a custom difficulty.
+*
+* Postcondition:
+*	A board w/the user's specified rows, columns, and mines is
+*	created, after asking again for any number out of range.
+**********************************************************************/
+void Minesweeper::ChooseCustomBoard()
+{
+	int rows = 0;		//User specified # rows
+	int columns = 0;	//User specified # columns
+	int mines = -1;		//User specified # mines
+
+	cout << "\nNumber of rows: ";
+	cin >> rows;
+	cin.clear();
+	cin.ignore(cin.rdbuf()->in_avail());	//In case char goes into an int
+
+	while (rows < 1 || rows > MAX_CUSTOM_SIZE)
+	{
+		cout << "\nRows must be a number between 1 and " << MAX_CUSTOM_SIZE
+			<< ". Please try again: ";
+		cin >> rows;
+		cin.clear();
+		cin.ignore(cin.rdbuf()->in_avail());	//In case char goes into an int
+	}
+
+	cout << "Number of columns: ";
+	cin >> columns;
+	cin.clear();
+	cin.ignore(cin.rdbuf()->in_avail());	//In case char goes into an int
+
+	while (columns < 1 || columns > MAX_CUSTOM_SIZE)
+	{
+		cout << "\nColumns must be a number between 1 and " << MAX_CUSTOM_SIZE
+			<< ". Please try again: ";
+		cin >> columns;
+		cin.clear();
+		cin.ignore(cin.rdbuf()->in_avail());	//In case char goes into an int
+	}
+
+	cout << "Number of mines: ";
+	cin >> mines;
+	cin.clear();
+	cin.ignore(cin.rdbuf()->in_avail());	//In case char goes into an int
+
+	//At least one cell must be safe to uncover
+	while (mines < 0 || mines > rows * columns - 1)
+	{
+		cout << "\nMines must be a number between 0 and " << rows * columns - 1
+			<< ". Please try again: ";
+		cin >> mines;
+		cin.clear();
+		cin.ignore(cin.rdbuf()->in_avail());	//In case char goes into an int
+	}
+
+	m_gameBoard.CreateBoard(rows, columns, mines);
+}
+
 /**********************************************************************
 * Purpose:
 *	To run the main portion of the game until the user either quits,
@@ -208,8 +366,12 @@ void Minesweeper::InterpretDifficultyChoice(int choice)
 **********************************************************************/
 void Minesweeper::GameLoop()
 {
+	//Show as much of the board as fits the terminal, w/room for prompts
+	m_renderer->FitToTerminal(PROMPT_LINES);
+	m_renderer->ScrollTo(0, 0);
+
 	//Display initial game board and key symbols on board
-	m_gameBoard.DisplayBoard();
+	m_renderer->Draw(m_gameBoard);
 	ExplainBoardSymbols();
 
 	//Stay in loop until user quits, wins, or looses
@@ -242,7 +404,8 @@ void Minesweeper::ExplainBoardSymbols()
 /**********************************************************************
 * Purpose:
 *	To allow the user to choose whether to uncover a cell, flag a cell,
-*	remove a flag from a cell, or quit the current game.
+*	remove a flag from a cell, quit the current game, or scroll the
+*	board.
 *
 * Precondition:
 *	Called throughout the course of the game from the GameLoop() method.
@@ -259,15 +422,16 @@ void Minesweeper::ChooseAction()
 		<< "1) Uncover a cell\n"
 		<< "2) Flag a cell\n"
 		<< "3) Remove a flag\n"
-		<< "4) Quit this game\n";
+		<< "4) Quit this game\n"
+		<< "5) Scroll the board\n";
 	cout << "Your choice: ";
 	cin >> choice;
 	cin.clear();
 	cin.ignore(cin.rdbuf()->in_avail());	//In case char goes into an int
 
-	while (choice < 1 || choice > 4)
+	while (choice < 1 || choice > 5)
 	{
-		cout << "\nChoice must be a number between 1 and 4. Please try again: ";
+		cout << "\nChoice must be a number between 1 and 5. Please try again: ";
 		cin >> choice;
 		cin.clear();
 		cin.ignore(cin.rdbuf()->in_avail());	//In case char goes into an int
@@ -305,6 +469,9 @@ void Minesweeper::InterpretActionChoice(int choice)
 	case 4:
 		m_endGame = true;
 		break;
+	case 5:
+		ScrollBoard();
+		break;
 	}
 }
 
@@ -328,7 +495,7 @@ void Minesweeper::UncoverCell()
 	int col = -1;	//User specified column coordinate
 
 	//Display current game board and key symbols on board
-	m_gameBoard.DisplayBoard();
+	m_renderer->Draw(m_gameBoard);
 	ExplainBoardSymbols();
 
 	//Prompt for cell to uncover
@@ -346,31 +513,29 @@ void Minesweeper::UncoverCell()
 	try
 	{
 		//Uncover cell and re-display board
-		m_gameBoard.UncoverCell(row, col);
-		m_gameBoard.DisplayBoard();
+		MoveResult result = m_gameBoard.UncoverCell(row, col);
+		m_renderer->Draw(m_gameBoard);
 		ExplainBoardSymbols();
 
-		//Check if cell contains a mine
-		if (m_gameBoard.IsMine(row, col) == true)
+		//Check if cell contained a mine or user won game
+		if (result.status == MOVE_HIT_MINE)
 		{
 			m_endGame = true;
 			cout << "\n\nThat cell contained a mine. Game over.\n\n";
 		}
+		else if (result.status == MOVE_WON)
+		{
+			m_endGame = true;
+			cout << "\n\nYou won!\n\n";
+		}
 	}
 	catch (Exception & ex)
 	{	
 		//Re-display board and display exception
-		m_gameBoard.DisplayBoard();
+		m_renderer->Draw(m_gameBoard);
 		ExplainBoardSymbols();
 		cout << "\n\n" << ex;
 	}
-
-	//Check if user won game
-	if (m_gameBoard.WonGame() == true)
-	{
-		m_endGame = true;
-		cout << "\n\nYou won!\n\n";
-	}
 }
 
 /**********************************************************************
@@ -392,7 +557,7 @@ void Minesweeper::FlagCell()
 	int col = -1;	//User specified column coordinate
 
 	//Display current game board and key symbols on board
-	m_gameBoard.DisplayBoard();
+	m_renderer->Draw(m_gameBoard);
 	ExplainBoardSymbols();
 
 	//Prompt for cell to flag
@@ -410,24 +575,24 @@ void Minesweeper::FlagCell()
 	try
 	{
 		//Flag cell and re-display board
-		m_gameBoard.FlagCell(row, col);
-		m_gameBoard.DisplayBoard();
+		MoveResult result = m_gameBoard.FlagCell(row, col);
+		m_renderer->Draw(m_gameBoard);
 		ExplainBoardSymbols();
+
+		//Check if user won game
+		if (result.status == MOVE_WON)
+		{
+			m_endGame = true;
+			cout << "\n\nYou won!\n\n";
+		}
 	}
 	catch (Exception & ex)
 	{
 		//Re-display board and display exception
-		m_gameBoard.DisplayBoard();
+		m_renderer->Draw(m_gameBoard);
 		ExplainBoardSymbols();
 		cout << "\n\n" << ex;
 	}
-
-	//Check if user won game
-	if (m_gameBoard.WonGame() == true)
-	{
-		m_endGame = true;
-		cout << "\n\nYou won!\n\n";
-	}
 }
 
 /**********************************************************************
@@ -450,7 +615,7 @@ void Minesweeper::RemoveFlaggedCell()
 	int col = -1;	//User specified column coordinate
 
 	//Display current game board and key symbols on board
-	m_gameBoard.DisplayBoard();
+	m_renderer->Draw(m_gameBoard);
 	ExplainBoardSymbols();
 
 	//Prompt for cell to remove flag from
@@ -467,23 +632,78 @@ void Minesweeper::RemoveFlaggedCell()
 
 	try
 	{
-		//Flag cell and re-display board
-		m_gameBoard.RemoveFlaggedCell(row, col);
-		m_gameBoard.DisplayBoard();
+		//Remove flag and re-display board
+		MoveResult result = m_gameBoard.RemoveFlaggedCell(row, col);
+		m_renderer->Draw(m_gameBoard);
 		ExplainBoardSymbols();
+
+		//Check if user won game
+		if (result.status == MOVE_WON)
+		{
+			m_endGame = true;
+			cout << "\n\nYou won!\n\n";
+		}
 	}
 	catch (Exception & ex)
 	{
 		//Re-display board and display exception
-		m_gameBoard.DisplayBoard();
+		m_renderer->Draw(m_gameBoard);
 		ExplainBoardSymbols();
 		cout << "\n\n" << ex;
 	}
+}
 
-	//Check if user won game
-	if (m_gameBoard.WonGame() == true)
-	{
-		m_endGame = true;
-		cout << "\n\nYou won!\n\n";
-	}
+/**********************************************************************
+* Purpose:
+*	To allow the user to specify which part of a board too big for
+*	the terminal to look at.
+*
+* Precondition:
+*	User chooses to scroll the board.
+*
+* Postcondition:
+*	The board is re-displayed w/the user specified cell in the top
+*	left corner, or as close as the edges of the board allow.
+**********************************************************************/
+void Minesweeper::ScrollBoard()
+{
+	int row = 0;	//User specified row coordinate
+	int col = 0;	//User specified column coordinate
+
+	//Display current game board and key symbols on board
+	m_renderer->Draw(m_gameBoard);
+	ExplainBoardSymbols();
+
+	//Prompt for cell to show at top left
+	cout << "\n\nPlease enter coordinates of cell to show at the top left.\n";
+	cout << "Row coordinate: ";
+	cin >> row;
+	cin.clear();
+	cin.ignore(cin.rdbuf()->in_avail());	//In case char goes into an int
+
+	cout << "Column coordinate: ";
+	cin >> col;
+	cin.clear();
+	cin.ignore(cin.rdbuf()->in_avail());	//In case char goes into an int
+
+	//Scroll and re-display board
+	m_renderer->ScrollTo(row, col);
+	m_renderer->Draw(m_gameBoard);
+	ExplainBoardSymbols();
+}
+
+/**********************************************************************
+* Purpose:
+*	To let generic code (and std::swap callers using ADL) exchange two
+*	Minesweepers without copying them.
+*
+* Precondition:
+*	Two existing Minesweeper objects passed by ref.
+*
+* Postcondition:
+*	Each Minesweeper holds the data the other held before.
+**********************************************************************/
+void swap(Minesweeper & lhs, Minesweeper & rhs) noexcept
+{
+	lhs.swap(rhs);
 }
\ No newline at end of file
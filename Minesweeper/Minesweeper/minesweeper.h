@@ -2,7 +2,7 @@
 * Author:			Molli Drivdahl
 * Filename:			minesweeper.h
 * Date Created:		1/12/16
-* Modifications:	1/17/16
+* Modifications:	10/17/26
 *
 * Class: Minesweeper
 *
@@ -15,13 +15,28 @@
 *	Minesweeper()
 *		Creates a Minesweeper game with a board to hold the data and
 *		the bool to signal the end of the game initialized to false.
+*		The board is drawn on an ANSI terminal, and the first cell
+*		uncovered in each game never holds a mine.
+*
+*	explicit Minesweeper(Renderer * renderer)
+*		Creates a Minesweeper game whose board is drawn w/the given
+*		renderer, which the game shares but does not own.
 *
 *	Minesweeper(const Minesweeper & copy)
 *
+*	Minesweeper(Minesweeper && move)
+*		Takes over the data of an expiring Minesweeper without copying it.
+*
 *	~Minesweeper()
 *
 *	Minesweeper & operator=(const Minesweeper & rhs)
 *
+*	Minesweeper & operator=(Minesweeper && rhs)
+*		Takes over the data of an expiring Minesweeper without copying it.
+*
+*	void swap(Minesweeper & other)
+*		Exchanges the data of two Minesweepers without copying it.
+*
 * Methods:
 *	void RunGame()
 *		Provides the entrance into the game and exit out of the game.
@@ -32,6 +47,9 @@
 *	void InterpretDifficultyChoice(int choice)
 *		Creates board based on user's specified difficulty
 *
+*	void ChooseCustomBoard()
+*		Creates board of user's specified size and number of mines.
+*
 *	void GameLoop()
 *		Loops through the main portion of the game until the user
 *		either quits, wins, or loses.
@@ -53,12 +71,16 @@
 *
 *	void RemoveFlaggedCell()
 *		Allows user to specify which cell to remove a flag from.
+*
+*	void ScrollBoard()
+*		Allows user to specify which part of a large board to view.
 **********************************************************************/
 
 #ifndef MINESWEEPER_H
 #define MINESWEEPER_H
 
 #include "board.h"
+#include "renderer.h"
 
 class Minesweeper
 {
@@ -66,15 +88,27 @@ class Minesweeper
 		//Default Ctor
 		Minesweeper();
 
+		//Game drawn w/a given renderer
+		explicit Minesweeper(Renderer * renderer);
+
 		//Copy Ctor
 		Minesweeper(const Minesweeper & copy);
 
+		//Move Ctor
+		Minesweeper(Minesweeper && move) noexcept;
+
 		//Default Dtor
 		~Minesweeper();
 
 		//Assignment Operator
 		Minesweeper & operator=(const Minesweeper & rhs);
 
+		//Move Assignment Operator
+		Minesweeper & operator=(Minesweeper && rhs) noexcept;
+
+		//Exchange data with another Minesweeper
+		void swap(Minesweeper & other) noexcept;
+
 		//Provides the entrance into the game and exit out of the game
 		void RunGame();
 
@@ -85,6 +119,9 @@ class Minesweeper
 		//Creates board based on user specified difficulty
 		void InterpretDifficultyChoice(int choice);
 
+		//Creates board of user specified size
+		void ChooseCustomBoard();
+
 		//Runs the game until the user quits, wins, or loses
 		void GameLoop();
 
@@ -106,8 +143,15 @@ class Minesweeper
 		//Allows user to specify which flag to remove
 		void RemoveFlaggedCell();
 
+		//Allows user to specify which part of the board to view
+		void ScrollBoard();
+
 		Board m_gameBoard;	//Actual board for game
+		Renderer * m_renderer;	//Draws the board (not owned)
 		bool m_endGame;		//Flags when game is over
 };
 
+//Exchange two Minesweepers without copying them
+void swap(Minesweeper & lhs, Minesweeper & rhs) noexcept;
+
 #endif //MINESWEEPER_H
\ No newline at end of file
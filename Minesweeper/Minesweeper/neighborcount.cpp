@@ -0,0 +1,195 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			neighborcount.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "neighborcount.h"
+
+#include <cstddef>
+
+//SIMD kernels are only built for x86 targets
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define NEIGHBORCOUNT_X86
+
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_SSE2
+#define TARGET_AVX2
+#else
+#define TARGET_SSE2 __attribute__((target("sse2")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+//Signature shared by every version of the kernel
+typedef void (*CountRowFunc)(const uint8_t * above, const uint8_t * middle,
+	const uint8_t * below, int col, uint8_t * counts);
+
+/**********************************************************************
+* Purpose:
+*	To count the adjacent mines of one row of cells, one cell at a
+*	time. Also finishes the cells left over by the SIMD kernels.
+*
+* Precondition:
+*	Pointers to the column before the first cell of the padded rows
+*	above, at, and below the row being counted, the number of cells
+*	in the row, and where to write the counts.
+*
+* Postcondition:
+*	Each count holds the number of adjacent mines of its cell.
+**********************************************************************/
+static void CountRowScalar(const uint8_t * above, const uint8_t * middle,
+	const uint8_t * below, int col, uint8_t * counts)
+{
+	for (int j = 0; j < col; j++)
+	{
+		counts[j] = static_cast<uint8_t>(above[j] + above[j + 1] + above[j + 2] +
+			middle[j] + middle[j + 2] +
+			below[j] + below[j + 1] + below[j + 2]);
+	}
+}
+
+#ifdef NEIGHBORCOUNT_X86
+/**********************************************************************
+* Purpose:
+*	To count the adjacent mines of one row of cells, 16 cells at a
+*	time with SSE2.
+*
+* Precondition:
+*	Same as CountRowScalar().
+*
+* Postcondition:
+*	Each count holds the number of adjacent mines of its cell.
+**********************************************************************/
+TARGET_SSE2 static void CountRowSSE2(const uint8_t * above, const uint8_t * middle,
+	const uint8_t * below, int col, uint8_t * counts)
+{
+	int j = 0;
+
+	//Counts never exceed 8, so bytes can be added without overflow
+	for (; j + 16 <= col; j += 16)
+	{
+		__m128i sum = _mm_loadu_si128(reinterpret_cast<const __m128i *>(above + j));
+		sum = _mm_add_epi8(sum, _mm_loadu_si128(reinterpret_cast<const __m128i *>(above + j + 1)));
+		sum = _mm_add_epi8(sum, _mm_loadu_si128(reinterpret_cast<const __m128i *>(above + j + 2)));
+		sum = _mm_add_epi8(sum, _mm_loadu_si128(reinterpret_cast<const __m128i *>(middle + j)));
+		sum = _mm_add_epi8(sum, _mm_loadu_si128(reinterpret_cast<const __m128i *>(middle + j + 2)));
+		sum = _mm_add_epi8(sum, _mm_loadu_si128(reinterpret_cast<const __m128i *>(below + j)));
+		sum = _mm_add_epi8(sum, _mm_loadu_si128(reinterpret_cast<const __m128i *>(below + j + 1)));
+		sum = _mm_add_epi8(sum, _mm_loadu_si128(reinterpret_cast<const __m128i *>(below + j + 2)));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(counts + j), sum);
+	}
+
+	//Finish the cells that don't fill a whole register
+	CountRowScalar(above + j, middle + j, below + j, col - j, counts + j);
+}
+
+/**********************************************************************
+* Purpose:
+*	To count the adjacent mines of one row of cells, 32 cells at a
+*	time with AVX2.
+*
+* Precondition:
+*	Same as CountRowScalar(). The CPU supports AVX2.
+*
+* Postcondition:
+*	Each count holds the number of adjacent mines of its cell.
+**********************************************************************/
+TARGET_AVX2 static void CountRowAVX2(const uint8_t * above, const uint8_t * middle,
+	const uint8_t * below, int col, uint8_t * counts)
+{
+	int j = 0;
+
+	//Counts never exceed 8, so bytes can be added without overflow
+	for (; j + 32 <= col; j += 32)
+	{
+		__m256i sum = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(above + j));
+		sum = _mm256_add_epi8(sum, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(above + j + 1)));
+		sum = _mm256_add_epi8(sum, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(above + j + 2)));
+		sum = _mm256_add_epi8(sum, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(middle + j)));
+		sum = _mm256_add_epi8(sum, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(middle + j + 2)));
+		sum = _mm256_add_epi8(sum, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(below + j)));
+		sum = _mm256_add_epi8(sum, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(below + j + 1)));
+		sum = _mm256_add_epi8(sum, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(below + j + 2)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(counts + j), sum);
+	}
+
+	//Finish the cells with the narrower kernel
+	CountRowSSE2(above + j, middle + j, below + j, col - j, counts + j);
+}
+#endif
+
+/**********************************************************************
+* Purpose:
+*	To pick the fastest version of the row kernel the CPU running the
+*	program supports.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The AVX2, SSE2, or scalar row kernel is returned.
+**********************************************************************/
+static CountRowFunc SelectCountRow()
+{
+#ifdef NEIGHBORCOUNT_X86
+#ifdef _MSC_VER
+	int info[4] = { 0 };
+	__cpuid(info, 0);
+	int maxLeaf = info[0];
+
+	__cpuid(info, 1);
+	bool hasSSE2 = (info[3] & (1 << 26)) != 0;
+	bool hasOSXSave = (info[2] & (1 << 27)) != 0;
+	bool hasAVX2 = false;
+
+	//AVX2 also needs the OS to save the wide registers
+	if (maxLeaf >= 7 && hasOSXSave && (_xgetbv(0) & 6) == 6)
+	{
+		__cpuidex(info, 7, 0);
+		hasAVX2 = (info[1] & (1 << 5)) != 0;
+	}
+#else
+	__builtin_cpu_init();
+	bool hasSSE2 = __builtin_cpu_supports("sse2") != 0;
+	bool hasAVX2 = __builtin_cpu_supports("avx2") != 0;
+#endif
+
+	if (hasAVX2)
+		return CountRowAVX2;
+	if (hasSSE2)
+		return CountRowSSE2;
+#endif
+
+	return CountRowScalar;
+}
+
+/**********************************************************************
+* Purpose:
+*	To count the adjacent mines of every cell of a padded mine plane.
+*
+* Precondition:
+*	A pointer to the first cell inside the zero padding ring of the
+*	mine plane, the distance in bytes between padded rows, the number
+*	of rows and columns, and room for row x col counts.
+*
+* Postcondition:
+*	Each count holds the number of adjacent mines of its cell.
+**********************************************************************/
+void CountAdjacentMines(const uint8_t * mines, int mineStride, int row, int col, uint8_t * counts)
+{
+	//Checked once, on first use
+	static const CountRowFunc countRow = SelectCountRow();
+
+	for (int i = 0; i < row; i++)
+	{
+		//Start one column before the row so the kernels can read j .. j+2
+		const uint8_t * middle = mines + static_cast<ptrdiff_t>(i) * mineStride - 1;
+
+		countRow(middle - mineStride, middle, middle + mineStride, col, counts + static_cast<ptrdiff_t>(i) * col);
+	}
+}
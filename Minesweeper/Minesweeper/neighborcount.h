@@ -0,0 +1,36 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			neighborcount.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Purpose:
+*	This file provides the kernel that counts the mines around every
+*	cell of a board at once. The mines are given as a byte plane (one
+*	byte per cell, 1 for a mine and 0 otherwise) and each count is the
+*	sum of the 3x3 block around a cell minus the cell itself.
+*
+*	The plane must be padded with a ring of zero bytes on every side so
+*	no cell needs an edge check. The counts are computed 32 cells at a
+*	time with AVX2 or 16 at a time with SSE2, whichever the CPU running
+*	the program supports, and one at a time otherwise.
+*
+* Functions:
+*	void CountAdjacentMines(const uint8_t * mines, int mineStride,
+*							int row, int col, uint8_t * counts)
+*		Writes the number of adjacent mines of each of the row x col
+*		cells into counts, stored row-major with col bytes per row.
+*		mines points to the first cell inside the padding ring, and
+*		mineStride is the distance in bytes between padded rows (at
+*		least col + 2).
+**********************************************************************/
+
+#ifndef NEIGHBORCOUNT_H
+#define NEIGHBORCOUNT_H
+
+#include <cstdint>
+
+//Count the mines around every cell of a padded mine plane
+void CountAdjacentMines(const uint8_t * mines, int mineStride, int row, int col, uint8_t * counts);
+
+#endif //NEIGHBORCOUNT_H
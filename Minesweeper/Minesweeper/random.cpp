@@ -0,0 +1,266 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			random.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "random.h"
+
+#include <chrono>
+#include <ctime>
+
+/**********************************************************************
+* Purpose:
+*	To rotate the bits of a 64-bit word left.
+*
+* Precondition:
+*	The word and a shift in [1, 63].
+*
+* Postcondition:
+*	The rotated word is returned.
+**********************************************************************/
+static inline uint64_t RotateLeft(uint64_t word, int shift)
+{
+	return (word << shift) | (word >> (64 - shift));
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct a generator seeded w/the given seed.
+*
+* Precondition:
+*	The seed.
+*
+* Postcondition:
+*	The generator gives the numbers for that seed.
+**********************************************************************/
+Xoshiro256::Xoshiro256(uint64_t seed)
+{
+	Seed(seed);
+}
+
+/**********************************************************************
+* Purpose:
+*	To restart the generator from a seed. The state is filled from
+*	splitmix64, as the xoshiro authors recommend, so similar seeds
+*	still give unrelated numbers and the state is never all zero.
+*
+* Precondition:
+*	The seed.
+*
+* Postcondition:
+*	The generator gives the numbers for that seed.
+**********************************************************************/
+void Xoshiro256::Seed(uint64_t seed)
+{
+	for (int i = 0; i < 4; i++)
+		m_state[i] = SplitMix64(seed);
+}
+
+/**********************************************************************
+* Purpose:
+*	To step the generator (xoshiro256**).
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The next 64 random bits are returned.
+**********************************************************************/
+uint64_t Xoshiro256::Next()
+{
+	uint64_t result = RotateLeft(m_state[1] * 5, 7) * 9;
+	uint64_t shifted = m_state[1] << 17;
+
+	m_state[2] ^= m_state[0];
+	m_state[3] ^= m_state[1];
+	m_state[1] ^= m_state[2];
+	m_state[0] ^= m_state[3];
+	m_state[2] ^= shifted;
+	m_state[3] = RotateLeft(m_state[3], 45);
+
+	return result;
+}
+
+/**********************************************************************
+* Purpose:
+*	To draw a number below a bound w/o the bias of Next() % bound.
+*	Uses Lemire's multiply-shift: the high half of a 32x32-bit
+*	product maps the draw onto [0, bound), and the rare draws that
+*	would make some results more likely than others are redrawn.
+*
+* Precondition:
+*	The bound, greater than zero.
+*
+* Postcondition:
+*	A number in [0, bound) is returned, every one equally likely.
+**********************************************************************/
+uint32_t Xoshiro256::NextBelow(uint32_t bound)
+{
+	uint64_t product = (Next() >> 32) * bound;
+	uint32_t low = static_cast<uint32_t>(product);
+
+	//If the draw may be in the biased part, check & redraw
+	if (low < bound)
+	{
+		uint32_t threshold = (0u - bound) % bound;
+
+		while (low < threshold)
+		{
+			product = (Next() >> 32) * bound;
+			low = static_cast<uint32_t>(product);
+		}
+	}
+
+	return static_cast<uint32_t>(product >> 32);
+}
+
+/**********************************************************************
+* Purpose:
+*	To draw a number below a bound that may not fit in 32 bits, e.g.
+*	a cell of a board w/more than 2^32 cells. Small bounds go through
+*	NextBelow(), so they draw the same numbers; larger ones redraw
+*	the few draws below 2^64 % bound, so every result is equally
+*	likely.
+*
+* Precondition:
+*	The bound, greater than zero.
+*
+* Postcondition:
+*	A number in [0, bound) is returned, every one equally likely.
+**********************************************************************/
+uint64_t Xoshiro256::NextBelow64(uint64_t bound)
+{
+	if (bound <= UINT32_MAX)
+		return NextBelow(static_cast<uint32_t>(bound));
+
+	uint64_t threshold = (0u - bound) % bound;
+	uint64_t draw = Next();
+
+	while (draw < threshold)
+		draw = Next();
+
+	return draw % bound;
+}
+
+/**********************************************************************
+* Purpose:
+*	To make a seed for a run that doesn't need to be repeatable, from
+*	the clocks and a count of seeds made so far.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	A seed that differs from run to run (and call to call) is returned.
+**********************************************************************/
+uint64_t Xoshiro256::MakeSeed()
+{
+	static uint64_t count = 0;	//Seeds made so far
+
+	uint64_t mix = static_cast<uint64_t>(std::time(nullptr));
+
+	mix ^= static_cast<uint64_t>(
+		std::chrono::high_resolution_clock::now().time_since_epoch().count()) << 1;
+	mix += count++;
+
+	return SplitMix64(mix);
+}
+
+/**********************************************************************
+* Purpose:
+*	To step splitmix64, a generator that turns any 64-bit state into
+*	well mixed output, for seeding.
+*
+* Precondition:
+*	The splitmix64 state, passed by ref.
+*
+* Postcondition:
+*	The state is advanced and its next output is returned.
+**********************************************************************/
+uint64_t Xoshiro256::SplitMix64(uint64_t & state)
+{
+	uint64_t mixed = (state += 0x9E3779B97F4A7C15ull);
+
+	mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ull;
+	mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBull;
+
+	return mixed ^ (mixed >> 31);
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct a generator keyed w/the given seed.
+*
+* Precondition:
+*	The seed.
+*
+* Postcondition:
+*	The generator gives the numbers for that seed.
+**********************************************************************/
+Philox4x32::Philox4x32(uint64_t seed)
+{
+	Seed(seed);
+}
+
+/**********************************************************************
+* Purpose:
+*	To rekey the generator. Philox takes any key as it is, so the
+*	seed's halves are the key.
+*
+* Precondition:
+*	The seed.
+*
+* Postcondition:
+*	The generator gives the numbers for that seed.
+**********************************************************************/
+void Philox4x32::Seed(uint64_t seed)
+{
+	m_key[0] = static_cast<uint32_t>(seed);
+	m_key[1] = static_cast<uint32_t>(seed >> 32);
+}
+
+/**********************************************************************
+* Purpose:
+*	To hash a 128-bit counter into 128 random bits w/ten Philox
+*	rounds. Each round multiplies two words of the counter, mixing
+*	the high halves of the products into the other two words along
+*	w/the key, which is bumped by a Weyl constant between rounds.
+*
+* Precondition:
+*	The low and high halves of the counter, and where to write the
+*	four random words.
+*
+* Postcondition:
+*	The random words for the counter are written to out.
+**********************************************************************/
+void Philox4x32::Generate(uint64_t counterLow, uint64_t counterHigh, uint32_t out[4]) const
+{
+	const uint32_t MULTIPLIER_0 = 0xD2511F53u;
+	const uint32_t MULTIPLIER_1 = 0xCD9E8D57u;
+	const uint32_t WEYL_0 = 0x9E3779B9u;
+	const uint32_t WEYL_1 = 0xBB67AE85u;
+
+	uint32_t counter[4] = { static_cast<uint32_t>(counterLow),
+		static_cast<uint32_t>(counterLow >> 32), static_cast<uint32_t>(counterHigh),
+		static_cast<uint32_t>(counterHigh >> 32) };
+	uint32_t key[2] = { m_key[0], m_key[1] };
+
+	for (int round = 0; round < 10; round++)
+	{
+		uint64_t product0 = static_cast<uint64_t>(MULTIPLIER_0) * counter[0];
+		uint64_t product1 = static_cast<uint64_t>(MULTIPLIER_1) * counter[2];
+
+		counter[0] = static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0];
+		counter[1] = static_cast<uint32_t>(product1);
+		counter[2] = static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1];
+		counter[3] = static_cast<uint32_t>(product0);
+
+		key[0] += WEYL_0;
+		key[1] += WEYL_1;
+	}
+
+	for (int i = 0; i < 4; i++)
+		out[i] = counter[i];
+}
@@ -0,0 +1,112 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			random.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: Xoshiro256
+*
+* Purpose:
+*	This class is a small, fast pseudo-random generator (xoshiro256**)
+*	for placing mines. Unlike rand() it has 256 bits of state, gives
+*	the same numbers for the same seed on every platform, and draws
+*	numbers below a bound w/o any bias.
+*
+* Manager functions:
+*	explicit Xoshiro256(uint64_t seed = 0)
+*		Creates a generator seeded w/the given seed.
+*
+*	The copy ctor, dtor, and assignment operator are the compiler
+*	generated ones, so a copy carries on w/the same numbers.
+*
+* Methods:
+*	void Seed(uint64_t seed)
+*		Restarts the generator from a seed. Every seed, even zero, is
+*		spread over the whole state by splitmix64.
+*
+*	uint64_t Next()
+*		Returns the next 64 random bits.
+*
+*	uint32_t NextBelow(uint32_t bound)
+*	uint64_t NextBelow64(uint64_t bound)
+*		Return a number in [0, bound), every one equally likely.
+*		NextBelow64() gives the same numbers as NextBelow() for
+*		bounds that fit in 32 bits.
+*
+*	static uint64_t MakeSeed()
+*		Returns a seed that differs from run to run, for games that
+*		don't need to be repeatable.
+*
+* Class: Philox4x32
+*
+* Purpose:
+*	This class is a counter-based pseudo-random generator
+*	(Philox4x32-10). It has no state to step: the numbers for any
+*	128-bit counter are a keyed hash of it, so any part of a board can
+*	be made on its own, by any thread, in any order, and still come
+*	out the same.
+*
+* Manager functions:
+*	explicit Philox4x32(uint64_t seed = 0)
+*		Creates a generator keyed w/the given seed.
+*
+*	The copy ctor, dtor, and assignment operator are the compiler
+*	generated ones.
+*
+* Methods:
+*	void Seed(uint64_t seed)
+*		Rekeys the generator w/a seed.
+*
+*	void Generate(uint64_t counterLow, uint64_t counterHigh,
+*				  uint32_t out[4]) const
+*		Writes the 128 random bits for a counter to out.
+**********************************************************************/
+
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+class Xoshiro256
+{
+public:
+	//1-arg Ctor
+	explicit Xoshiro256(uint64_t seed = 0);
+
+	//Restart from a seed
+	void Seed(uint64_t seed);
+
+	//Next 64 random bits
+	uint64_t Next();
+
+	//Unbiased number in [0, bound)
+	uint32_t NextBelow(uint32_t bound);
+	uint64_t NextBelow64(uint64_t bound);
+
+	//Seed for a non-repeatable run
+	static uint64_t MakeSeed();
+
+private:
+	//Step splitmix64, returning its next output
+	static uint64_t SplitMix64(uint64_t & state);
+
+	uint64_t m_state[4];	//Generator state, never all zero
+};
+
+class Philox4x32
+{
+public:
+	//1-arg Ctor
+	explicit Philox4x32(uint64_t seed = 0);
+
+	//Rekey w/a seed
+	void Seed(uint64_t seed);
+
+	//128 random bits for a counter
+	void Generate(uint64_t counterLow, uint64_t counterHigh, uint32_t out[4]) const;
+
+private:
+	uint32_t m_key[2];	//Key the counters are hashed w/
+};
+
+#endif //RANDOM_H
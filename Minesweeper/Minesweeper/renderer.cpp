@@ -0,0 +1,298 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			renderer.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "renderer.h"
+#include "ansirenderer.h"
+
+#include <cstring>
+
+#include <iostream>
+using std::cout;
+using std::ostream;
+
+//Columns between column labels on the ruler
+const int PLAIN_LABEL_SPACING = 10;
+
+//Most chars the status line takes
+const int PLAIN_STATUS_CHARS = 64;
+
+/**********************************************************************
+* Purpose:
+*	To find how many chars a row or column # takes, e.g. to size the
+*	row ruler to the largest row #.
+*
+* Precondition:
+*	A row or column # (zero or more).
+*
+* Postcondition:
+*	The # decimal digits in the number is returned.
+**********************************************************************/
+int Renderer::CountDigits(int number)
+{
+	int digits = 1;
+
+	for (; number >= 10; number /= 10)
+		digits++;
+
+	return digits;
+}
+
+/**********************************************************************
+* Purpose:
+*	To write an integer as decimal text.
+*
+* Precondition:
+*	Where to write, w/room for 11 chars, and the integer to write.
+*
+* Postcondition:
+*	The integer's digits (and sign) are written, and the # chars
+*	written is returned.
+**********************************************************************/
+int Renderer::WriteNumber(char * out, int number)
+{
+	char digits[12];		//Enough for any int & its sign
+	int first = sizeof(digits);
+	unsigned int magnitude = (number < 0) ? 0u - static_cast<unsigned int>(number) :
+		static_cast<unsigned int>(number);
+
+	//Write digits from the right
+	do
+	{
+		digits[--first] = static_cast<char>('0' + magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude > 0);
+
+	if (number < 0)
+		digits[--first] = '-';
+
+	memcpy(out, digits + first, sizeof(digits) - first);
+
+	return static_cast<int>(sizeof(digits)) - first;
+}
+
+/**********************************************************************
+* Purpose:
+*	To destroy a Renderer through a pointer to the base class.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The Renderer is destroyed.
+**********************************************************************/
+Renderer::~Renderer()
+{}
+
+/**********************************************************************
+* Purpose:
+*	To make the next Draw() start over. Renderers that keep nothing
+*	between draws have nothing to do.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	<None>
+**********************************************************************/
+void Renderer::Invalidate()
+{}
+
+/**********************************************************************
+* Purpose:
+*	To clear the screen for output that isn't a board. Renderers that
+*	don't own a screen have nothing to do.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	<None>
+**********************************************************************/
+void Renderer::ClearScreen()
+{}
+
+/**********************************************************************
+* Purpose:
+*	To undo terminal settings before the program exits. Renderers
+*	that change no settings have nothing to do.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	<None>
+**********************************************************************/
+void Renderer::RestoreTerminal()
+{}
+
+/**********************************************************************
+* Purpose:
+*	To limit how much of a board is shown to the terminal window.
+*	Renderers that always show the whole board can't.
+*
+* Precondition:
+*	An integer specifying the # lines to leave for prompts.
+*
+* Postcondition:
+*	False is returned.
+**********************************************************************/
+bool Renderer::FitToTerminal(int)
+{
+	return false;
+}
+
+/**********************************************************************
+* Purpose:
+*	To show a board from the given top left cell. Renderers that
+*	always show the whole board have nothing to do.
+*
+* Precondition:
+*	Two integers specifying a row and column pair.
+*
+* Postcondition:
+*	<None>
+**********************************************************************/
+void Renderer::ScrollTo(int, int)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the renderer an interactive game uses unless it is
+*	given another.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	A pointer to a renderer for ANSI terminals that lives until the
+*	program exits is returned.
+**********************************************************************/
+Renderer * Renderer::GetDefault()
+{
+	static AnsiRenderer terminal;
+
+	return &terminal;
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct a PlainTextRenderer that writes to the given stream.
+*
+* Precondition:
+*	The stream to write to (nullptr for cout). The stream must outlive
+*	the PlainTextRenderer.
+*
+* Postcondition:
+*	The renderer writes to the stream and has no text composed yet.
+**********************************************************************/
+PlainTextRenderer::PlainTextRenderer(ostream * output) :
+m_output(output != nullptr ? output : &cout)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To write the whole board as plain text, starting on a new line: a
+*	column ruler labeling every tenth column & showing the last digit
+*	of every column, each row behind its label, and the status line.
+*	The text is composed in a buffer kept between draws, then written
+*	all at once.
+*
+* Precondition:
+*	A Board passed by const ref.
+*
+* Postcondition:
+*	The board and its status line are written to the stream.
+**********************************************************************/
+void PlainTextRenderer::Draw(const Board & board)
+{
+	int numRows = board.GetRow();
+	int numColumns = board.GetColumn();
+	int rulerWidth = CountDigits(numRows > 0 ? numRows - 1 : 0);
+	int lineLength = rulerWidth + 1 + numColumns * 2 + 1;	//Incl. newline
+
+	//Room for a line break, the rulers, rows, blank line, & status line
+	int needed = 1 + (numRows + 3) * lineLength + PLAIN_STATUS_CHARS;
+
+	if (m_text.getLength() < needed)
+		m_text.Resize(needed);
+
+	char * start = &m_text(0);
+	char * out = start;
+
+	//Start on a line of its own, even after a prompt
+	*out++ = '\n';
+
+	//Labels line, w/every label that ends inside the board
+	memset(out, ' ', lineLength - 1);
+
+	for (int j = 0; j < numColumns; j += PLAIN_LABEL_SPACING)
+	{
+		if (CountDigits(j) <= (numColumns - j) * 2)
+			WriteNumber(out + rulerWidth + 1 + j * 2, j);
+	}
+
+	out += lineLength - 1;
+	*out++ = '\n';
+
+	//Digits line
+	memset(out, ' ', rulerWidth + 1);
+	out += rulerWidth + 1;
+
+	for (int j = 0; j < numColumns; j++)
+	{
+		out[0] = static_cast<char>('0' + j % 10);
+		out[1] = ' ';
+		out += 2;
+	}
+
+	*out++ = '\n';
+
+	for (int i = 0; i < numRows; i++)
+	{
+		//Row label, right aligned
+		int padding = rulerWidth - CountDigits(i);
+
+		memset(out, ' ', padding);
+		out += padding;
+		out += WriteNumber(out, i);
+		*out++ = ' ';
+
+		for (int j = 0; j < numColumns; j++)
+		{
+			out[0] = CELL_GLYPHS[GetCellCode(board.GetCellState(i, j), board.GetCellValue(i, j))];
+			out[1] = ' ';
+			out += 2;
+		}
+
+		*out++ = '\n';
+	}
+
+	//Status line
+	memcpy(out, "\nMines remaining: ", 18);
+	out += 18;
+	out += WriteNumber(out, board.GetMinesRemaining());
+	memcpy(out, "   Cells left: ", 15);
+	out += 15;
+	out += WriteNumber(out, board.GetCellsLeft());
+	*out++ = '\n';
+
+	m_output->write(start, out - start);
+	m_output->flush();
+}
+
+/**********************************************************************
+* Purpose:
+*	To draw nothing at all.
+*
+* Precondition:
+*	A Board passed by const ref.
+*
+* Postcondition:
+*	<None>
+**********************************************************************/
+void NullRenderer::Draw(const Board &)
+{}
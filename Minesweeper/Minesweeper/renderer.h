@@ -0,0 +1,164 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			renderer.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: Renderer
+*
+* Purpose:
+*	This abstract class is how a game shows its Board. The Board only
+*	holds the game; a Renderer reads it through GetCellState() and
+*	GetCellValue() and decides what the user sees, so the engine has
+*	no tie to any console or to cout.
+*
+* Methods:
+*	void Draw(const Board & board)
+*		Shows the board and its status line.
+*
+*	void Invalidate()
+*		Makes the next Draw() start over instead of updating what it
+*		drew last. Does nothing by default.
+*
+*	void ClearScreen()
+*		Clears the screen for output that isn't a board. Does nothing
+*		by default.
+*
+*	void RestoreTerminal()
+*		Undoes any terminal settings before the program exits. Does
+*		nothing by default.
+*
+*	bool FitToTerminal(int reservedLines)
+*		Limits how much of a board is shown to the terminal window,
+*		less the given # lines of prompts. Returns false, doing
+*		nothing, by default.
+*
+*	void ScrollTo(int row, int column)
+*		Shows a board from the given top left cell, if only part of it
+*		is shown. Does nothing by default.
+*
+*	static Renderer * GetDefault()
+*		Returns the renderer for an interactive game, which draws on
+*		an ANSI terminal.
+*
+*	static int GetCellCode(State state, Value value)
+*		Returns what a cell looks like, as one small number per glyph.
+*
+*	static int CountDigits(int number)
+*		Returns the # chars a row or column # takes.
+*
+*	static int WriteNumber(char * out, int number)
+*		Writes an integer as decimal text, returning the # chars
+*		written. Shared by the renderers that compose text.
+*
+* Class: PlainTextRenderer
+*
+* Purpose:
+*	Writes the whole board as plain text w/rulers and no escape
+*	sequences, e.g. for logs or terminals w/o ANSI support. Each Draw()
+*	is composed into a buffer kept between draws and written at once.
+*
+* Manager functions:
+*	explicit PlainTextRenderer(std::ostream * output = nullptr)
+*		Creates a renderer that writes to output (cout by default).
+*
+*	The copy ctor, dtor, and assignment operator are the compiler
+*	generated ones.
+*
+* Class: NullRenderer
+*
+* Purpose:
+*	Draws nothing, so bulk simulations and automated tests that drive
+*	a game pay no rendering cost at all.
+**********************************************************************/
+
+#ifndef RENDERER_H
+#define RENDERER_H
+
+#include "board.h"
+
+#include <iosfwd>
+
+//Cell codes past the numbers 0-8
+const int MINE_CODE = 9;
+const int FLAG_CODE = 10;
+const int COVERED_CODE = 11;
+const int NUM_CELL_CODES = 12;
+
+//Cell code of each state (rows) & value (columns)
+constexpr uint8_t CELL_CODES[FLAGGED + 1][MINE + 1] =
+{
+	//Covered cells all look alike
+	{ COVERED_CODE, COVERED_CODE, COVERED_CODE, COVERED_CODE, COVERED_CODE,
+	COVERED_CODE, COVERED_CODE, COVERED_CODE, COVERED_CODE, COVERED_CODE },
+	//Uncovered cells show their value
+	{ 0, 1, 2, 3, 4, 5, 6, 7, 8, MINE_CODE },
+	//Flagged cells all look alike
+	{ FLAG_CODE, FLAG_CODE, FLAG_CODE, FLAG_CODE, FLAG_CODE,
+	FLAG_CODE, FLAG_CODE, FLAG_CODE, FLAG_CODE, FLAG_CODE }
+};
+
+//Glyph of each cell code: numbers, mine, flag, & "empty" covered spot
+constexpr char CELL_GLYPHS[NUM_CELL_CODES + 1] = "012345678#!*";
+
+class Renderer
+{
+public:
+	//Virtual Dtor
+	virtual ~Renderer();
+
+	//Show the board
+	virtual void Draw(const Board & board) = 0;
+
+	//Start over on next Draw
+	virtual void Invalidate();
+
+	//Clear screen for non-board output
+	virtual void ClearScreen();
+
+	//Undo terminal settings before exiting
+	virtual void RestoreTerminal();
+
+	//Limit what is shown to the terminal window
+	virtual bool FitToTerminal(int reservedLines);
+
+	//Move what is shown of the board
+	virtual void ScrollTo(int row, int column);
+
+	//Renderer for an interactive game
+	static Renderer * GetDefault();
+
+	//What a cell looks like
+	static constexpr int GetCellCode(State state, Value value)
+	{
+		return CELL_CODES[state][value];
+	}
+
+protected:
+	//Width of a row or column #
+	static int CountDigits(int number);
+
+	//Write an int as decimal text
+	static int WriteNumber(char * out, int number);
+};
+
+class PlainTextRenderer : public Renderer
+{
+public:
+	//1-arg Ctor
+	explicit PlainTextRenderer(std::ostream * output = nullptr);
+
+	void Draw(const Board & board);
+
+private:
+	std::ostream * m_output;	//Where the text goes
+	Array<char> m_text;			//Text composed for the output
+};
+
+class NullRenderer : public Renderer
+{
+public:
+	void Draw(const Board & board);
+};
+
+#endif //RENDERER_H
@@ -2,17 +2,20 @@
 * Author:			Molli Drivdahl
 * Filename:			row.h
 * Date Created:		1/8/16
-* Modifications:	1/12/16
+* Modifications:	10/17/26
 *
-* Class: Row
+* Classes: Row, ConstRow
 *
 * Purpose:
 *	This class creates a Row object to simulate a row element of a
 *	two-dimensional array. Its main purpose is to overload the []
 *	operator to access a column element of a two-dimensional array.
+*	A Row comes from a non-const Array2D and gives write access; a
+*	ConstRow comes from a const Array2D and only gives read access.
+*	Both have the same members, w/ConstRow returning const T &.
 *
 * Manager functions:
-*	Row(const Array2D<T> & array2D, int rowDesired)
+*	Row(Array2D<T> & array2D, int rowDesired)
 *		Creates a Row with data member values assigned to the values
 *		of the parameters.
 *
@@ -32,6 +35,14 @@
 *		the 2D array, and sends both desired row and column indices to
 *		the Select method of Array2D to return the row-major ordered
 *		index of the desired element.
+*
+*	T & at(int columnDesired) const
+*		Same as the [] operator, throwing an Exception if the column
+*		index is out of bounds.
+*
+*	T & operator()(int columnDesired) const
+*		Returns the element at the column without bounds checks. The
+*		bounds are only asserted, when ARRAY_ASSERT_BOUNDS is defined.
 **********************************************************************/
 
 #ifndef ROW_H
@@ -44,7 +55,7 @@ class Row
 {
 public:
 	//2-arg Ctor
-	Row(const Array2D<T> & array2D, int rowDesired);
+	Row(Array2D<T> & array2D, int rowDesired);
 
 	//Copy Ctor
 	Row(const Row<T> & copy);
@@ -61,6 +72,41 @@ public:
 	//Overloaded [] Operator
 	T & operator[](int columnDesired) const;
 
+	//Checked & unchecked element access
+	T & at(int columnDesired) const;
+	T & operator()(int columnDesired) const;
+
+private:
+	Array2D<T> & m_array2D;	//2D Array
+	int m_rowDesired;	//Row index to access
+};
+
+template <typename T>
+class ConstRow
+{
+public:
+	//2-arg Ctor
+	ConstRow(const Array2D<T> & array2D, int rowDesired);
+
+	//Copy Ctor
+	ConstRow(const ConstRow<T> & copy);
+
+	//Default Dtor
+	~ConstRow();
+
+	//Getter for m_rowDesired
+	int getRowDesired() const;
+
+	//Setter for m_rowDesired
+	void setRowDesired(int rowDesired);
+
+	//Overloaded [] Operator
+	const T & operator[](int columnDesired) const;
+
+	//Checked & unchecked element access
+	const T & at(int columnDesired) const;
+	const T & operator()(int columnDesired) const;
+
 private:
 	const Array2D<T> & m_array2D;	//2D Array
 	int m_rowDesired;	//Row index to access
@@ -78,7 +124,7 @@ private:
 *	Data members are initialized to the parameter values.
 **********************************************************************/
 template<typename T>
-Row<T>::Row(const Array2D<T> & array2D, int rowDesired) : m_array2D(array2D), m_rowDesired(rowDesired)
+Row<T>::Row(Array2D<T> & array2D, int rowDesired) : m_array2D(array2D), m_rowDesired(rowDesired)
 {}
 
 /**********************************************************************
@@ -139,6 +185,42 @@ T & Row<T>::operator[](int columnDesired) const
 	return m_array2D.Select(m_rowDesired, columnDesired);
 }
 
+/**********************************************************************
+* Purpose:
+*	To access a column element with the same bounds checks as the []
+*	operator.
+*
+* Precondition:
+*	An integer representing the desired column index.
+*
+* Postcondition:
+*	The element at the column is returned, or an Exception is thrown
+*	if the column index is out of bounds.
+**********************************************************************/
+template<typename T>
+T & Row<T>::at(int columnDesired) const
+{
+	return (*this)[columnDesired];
+}
+
+/**********************************************************************
+* Purpose:
+*	To access a column element without bounds checks, for loops whose
+*	indices are already known to be valid.
+*
+* Precondition:
+*	An integer representing a valid column index.
+*
+* Postcondition:
+*	The element at the column is returned. Bounds are only asserted,
+*	when ARRAY_ASSERT_BOUNDS is defined.
+**********************************************************************/
+template<typename T>
+T & Row<T>::operator()(int columnDesired) const
+{
+	return m_array2D(m_rowDesired, columnDesired);
+}
+
 /**********************************************************************
 * Purpose:
 *	To retrieve the value of the desired row.
@@ -171,4 +253,144 @@ void Row<T>::setRowDesired(int rowDesired)
 	m_rowDesired = rowDesired;
 }
 
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a ConstRow and initialize the data
+*	members to the values of the parameters.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are initialized to the parameter values.
+**********************************************************************/
+template<typename T>
+ConstRow<T>::ConstRow(const Array2D<T> & array2D, int rowDesired) : m_array2D(array2D), m_rowDesired(rowDesired)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a ConstRow with data members whose
+*	initial values are copied from an existing ConstRow object.
+*
+* Precondition:
+*	An existing ConstRow object passed by const ref.
+*
+* Postcondition:
+*	The data members are initialized to the values of the data members
+*	of the existing ConstRow object.
+**********************************************************************/
+template<typename T>
+ConstRow<T>::ConstRow(const ConstRow<T> & copy) : m_array2D(copy.m_array2D), m_rowDesired(copy.m_rowDesired)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To reset the data members to default values, and destroy the
+*	ConstRow.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are reset to default values.
+**********************************************************************/
+template<typename T>
+ConstRow<T>::~ConstRow()
+{
+	//Reset to default value
+	m_rowDesired = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To read a column element of a const 2D array, w/the same bounds
+*	checks as Row's [] operator.
+*
+* Precondition:
+*	An integer representing the desired column index.
+*
+* Postcondition:
+*	If column index value is valid, the element is returned by const
+*	ref, else an Exception is thrown.
+**********************************************************************/
+template<typename T>
+const T & ConstRow<T>::operator[](int columnDesired) const
+{
+	// If accessing invalid column index value
+	if (columnDesired < 0 || columnDesired >(m_array2D.getColumn() - 1))
+		throw Exception("ERROR: Array column index is out of bounds.");
+
+	//Return actual 2D array element from the row-major order format
+	return m_array2D.Select(m_rowDesired, columnDesired);
+}
+
+/**********************************************************************
+* Purpose:
+*	To read a column element with the same bounds checks as the []
+*	operator.
+*
+* Precondition:
+*	An integer representing the desired column index.
+*
+* Postcondition:
+*	The element at the column is returned, or an Exception is thrown
+*	if the column index is out of bounds.
+**********************************************************************/
+template<typename T>
+const T & ConstRow<T>::at(int columnDesired) const
+{
+	return (*this)[columnDesired];
+}
+
+/**********************************************************************
+* Purpose:
+*	To read a column element without bounds checks, for loops whose
+*	indices are already known to be valid.
+*
+* Precondition:
+*	An integer representing a valid column index.
+*
+* Postcondition:
+*	The element at the column is returned. Bounds are only asserted,
+*	when ARRAY_ASSERT_BOUNDS is defined.
+**********************************************************************/
+template<typename T>
+const T & ConstRow<T>::operator()(int columnDesired) const
+{
+	return m_array2D(m_rowDesired, columnDesired);
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the value of the desired row.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The value of the desired row is returned.
+**********************************************************************/
+template<typename T>
+int ConstRow<T>::getRowDesired() const
+{
+	return m_rowDesired;
+}
+
+/**********************************************************************
+* Purpose:
+*	To set the value of the desired row.
+*
+* Precondition:
+*	An integer specifying the desired row element.
+*
+* Postcondition:
+*	The value of the desired row is set to the parameter value.
+**********************************************************************/
+template<typename T>
+void ConstRow<T>::setRowDesired(int rowDesired)
+{
+	m_rowDesired = rowDesired;
+}
+
 #endif //ROW_H
\ No newline at end of file
@@ -0,0 +1,390 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			stack.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: Stack
+*
+* Purpose:
+*	This class creates a last-in first-out stack stored in an Array.
+*	The Array grows by doubling, and Clear() keeps its storage, so a
+*	Stack that is reused for one job after another stops allocating
+*	once it has grown to the largest size needed.
+*
+* Manager functions:
+*	Stack()
+*		Creates an empty Stack.
+*
+*	explicit Stack(MemoryResource * resource)
+*		Creates an empty Stack that will get its storage from the
+*		given resource.
+*
+*	Stack(const Stack & copy)
+*
+*	Stack(Stack && move)
+*		Takes over the data of an expiring Stack without copying it.
+*
+*	~Stack()
+*
+*	Stack & operator=(const Stack & rhs)
+*
+*	Stack & operator=(Stack && rhs)
+*		Takes over the data of an expiring Stack without copying it.
+*
+*	void swap(Stack & other)
+*		Exchanges the data of two Stacks without copying it.
+*
+* Methods:
+*	void Push(const T & item)
+*		Adds an item to the top of the Stack.
+*
+*	T Pop()
+*		Removes the item on top of the Stack and returns it. Throws an
+*		Exception if the Stack is empty.
+*
+*	T & Peek() const
+*		Returns the item on top of the Stack. Throws an Exception if
+*		the Stack is empty.
+*
+*	bool isEmpty() const
+*		Returns whether the Stack holds no items.
+*
+*	int getSize() const
+*		Returns the number of items on the Stack.
+*
+*	void Clear()
+*		Removes every item but keeps the storage for reuse.
+**********************************************************************/
+
+#ifndef STACK_H
+#define STACK_H
+
+#include "array.h"
+
+#include <utility>
+
+//Capacity of the first storage a Stack allocates
+const int STACK_INITIAL_CAPACITY = 64;
+
+template <typename T>
+class Stack
+{
+public:
+	//Default Ctor
+	Stack();
+
+	//Empty Stack drawing storage from a resource
+	explicit Stack(MemoryResource * resource);
+
+	//Copy Ctor
+	Stack(const Stack<T> & copy);
+
+	//Move Ctor
+	Stack(Stack<T> && move) noexcept;
+
+	//Default Dtor
+	~Stack();
+
+	//Assignment Operator
+	Stack<T> & operator=(const Stack<T> & rhs);
+
+	//Move Assignment Operator
+	Stack<T> & operator=(Stack<T> && rhs) noexcept;
+
+	//Exchange data with another Stack
+	void swap(Stack<T> & other) noexcept;
+
+	//Add & remove items
+	void Push(const T & item);
+	T Pop();
+
+	//Look at top item
+	T & Peek() const;
+
+	//Getters for stack size
+	bool isEmpty() const;
+	int getSize() const;
+
+	//Remove every item but keep storage
+	void Clear();
+
+private:
+	Array<T> m_items;	//Storage, items [0, m_size) are on the stack
+	int m_size;			//Number of items on the stack
+};
+
+/**********************************************************************
+* Purpose:
+*	To construct an empty Stack.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The Stack holds no items and no storage.
+**********************************************************************/
+template <typename T>
+Stack<T>::Stack() : m_size(0)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct an empty Stack that will get its storage from the
+*	given resource.
+*
+* Precondition:
+*	The resource to get storage from (nullptr for the heap). The
+*	resource must outlive the Stack.
+*
+* Postcondition:
+*	The Stack holds no items and no storage.
+**********************************************************************/
+template <typename T>
+Stack<T>::Stack(MemoryResource * resource) : m_items(resource), m_size(0)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a Stack with the items of an existing
+*	Stack.
+*
+* Precondition:
+*	An existing Stack object passed by const ref.
+*
+* Postcondition:
+*	The Stack holds the same items as the existing Stack.
+**********************************************************************/
+template <typename T>
+Stack<T>::Stack(const Stack<T> & copy) : m_items(copy.m_items), m_size(copy.m_size)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a Stack by taking over the data of an
+*	expiring Stack object instead of copying it.
+*
+* Precondition:
+*	An expiring Stack object passed by rvalue ref.
+*
+* Postcondition:
+*	The Stack holds the data of the expiring Stack, which is left
+*	empty.
+**********************************************************************/
+template <typename T>
+Stack<T>::Stack(Stack<T> && move) noexcept : m_items(std::move(move.m_items)),
+m_size(move.m_size)
+{
+	//Leave expiring Stack empty
+	move.m_size = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To reset the size to zero and destroy the Stack.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The Stack is empty.
+**********************************************************************/
+template <typename T>
+Stack<T>::~Stack()
+{
+	m_size = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To assign one existing Stack object to another existing Stack
+*	object by copying its items.
+*
+* Precondition:
+*	An existing Stack object passed by const ref.
+*
+* Postcondition:
+*	The Stack holds the same items as the rhs Stack.
+**********************************************************************/
+template <typename T>
+Stack<T> & Stack<T>::operator=(const Stack<T> & rhs)
+{
+	if (this != &rhs)
+	{
+		//Use Array's assignment operator
+		m_items = rhs.m_items;
+		m_size = rhs.m_size;
+	}
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To assign an expiring Stack object to an existing Stack object by
+*	taking over its data instead of copying it.
+*
+* Precondition:
+*	An expiring Stack object passed by rvalue ref.
+*
+* Postcondition:
+*	The existing Stack holds the data of the expiring Stack, which is
+*	left holding the old data of the existing Stack until it is
+*	destroyed.
+**********************************************************************/
+template <typename T>
+Stack<T> & Stack<T>::operator=(Stack<T> && rhs) noexcept
+{
+	swap(rhs);
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To exchange the data of two Stacks without copying any items.
+*
+* Precondition:
+*	An existing Stack object passed by ref.
+*
+* Postcondition:
+*	Each Stack holds the data the other held before.
+**********************************************************************/
+template <typename T>
+void Stack<T>::swap(Stack<T> & other) noexcept
+{
+	m_items.swap(other.m_items);
+	std::swap(m_size, other.m_size);
+}
+
+/**********************************************************************
+* Purpose:
+*	To add an item to the top of the Stack, doubling the storage when
+*	it is full so a run of pushes costs constant time each on average.
+*
+* Precondition:
+*	The item to add.
+*
+* Postcondition:
+*	The item is on top of the Stack.
+**********************************************************************/
+template <typename T>
+void Stack<T>::Push(const T & item)
+{
+	//If storage is full, double it (keeping the items)
+	if (m_size == m_items.getLength())
+		m_items.setLength(m_size > 0 ? m_size * 2 : STACK_INITIAL_CAPACITY);
+
+	m_items(m_size) = item;
+	m_size++;
+}
+
+/**********************************************************************
+* Purpose:
+*	To remove the item on top of the Stack.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The item that was on top is removed and returned; else, an
+*	Exception is thrown if the Stack is empty.
+**********************************************************************/
+template <typename T>
+T Stack<T>::Pop()
+{
+	if (m_size == 0)
+		throw Exception("ERROR: Cannot pop from an empty stack.");
+
+	m_size--;
+
+	return m_items(m_size);
+}
+
+/**********************************************************************
+* Purpose:
+*	To look at the item on top of the Stack without removing it.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The item on top is returned; else, an Exception is thrown if the
+*	Stack is empty.
+**********************************************************************/
+template <typename T>
+T & Stack<T>::Peek() const
+{
+	if (m_size == 0)
+		throw Exception("ERROR: Cannot peek at an empty stack.");
+
+	return m_items(m_size - 1);
+}
+
+/**********************************************************************
+* Purpose:
+*	To determine whether the Stack holds no items.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	True is returned if the Stack is empty.
+**********************************************************************/
+template <typename T>
+bool Stack<T>::isEmpty() const
+{
+	return m_size == 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the number of items on the Stack.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of items is returned.
+**********************************************************************/
+template <typename T>
+int Stack<T>::getSize() const
+{
+	return m_size;
+}
+
+/**********************************************************************
+* Purpose:
+*	To remove every item while keeping the storage, so the Stack can
+*	be filled again without allocating.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The Stack is empty and keeps its storage.
+**********************************************************************/
+template <typename T>
+void Stack<T>::Clear()
+{
+	m_size = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To let generic code (and std::swap callers using ADL) exchange two
+*	Stacks without copying them.
+*
+* Precondition:
+*	Two existing Stack objects passed by ref.
+*
+* Postcondition:
+*	Each Stack holds the data the other held before.
+**********************************************************************/
+template <typename T>
+void swap(Stack<T> & lhs, Stack<T> & rhs) noexcept
+{
+	lhs.swap(rhs);
+}
+
+#endif //STACK_H
@@ -2,7 +2,7 @@
 * Author:			Molli Drivdahl
 * Filename:			stub.cpp
 * Date Created:		1/12/16
-* Modifications:	1/17/16
+* Modifications:	10/17/26
 *
 * Lab/Assignment: Lab 1  Minesweeper
 * 
@@ -29,18 +29,42 @@
 *	The output will be displayed to the screen. Instructions for the
 *	user, error messages to the user, and a the game board will be
 *	displayed to the screen. 
+*
+* Options:
+*	--plain	Draw the board as plain text, for terminals w/o ANSI
+*			escape sequences.
+*	--null	Don't draw the board, e.g. for scripted play.
 **********************************************************************/
 
 #include "minesweeper.h"
 
-#include <crtdbg.h> 
+#include <cstring>
+
+//Leak checking only exists in the MSVC debug runtime
+#ifdef _MSC_VER
 #define _CRTDBG_MAP_ALLOC
+#include <crtdbg.h> 
+#endif
 
-int main()
+int main(int argc, char * argv[])
 {
+#ifdef _MSC_VER
 	_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
+
+	PlainTextRenderer plainText;	//Board as plain text
+	NullRenderer none;				//No board at all
+	Renderer * renderer = nullptr;	//ANSI terminal unless an option says otherwise
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--plain") == 0)
+			renderer = &plainText;
+		else if (strcmp(argv[i], "--null") == 0)
+			renderer = &none;
+	}
 
-	Minesweeper minesweeperGame;	//Create a Minesweeper game
+	Minesweeper minesweeperGame(renderer);	//Create a Minesweeper game
 	minesweeperGame.RunGame();		//Start the Minesweeper game
 
 	return 0;
@@ -0,0 +1,202 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			threadpool.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "threadpool.h"
+
+/**********************************************************************
+* Purpose:
+*	To construct a pool and start its worker threads.
+*
+* Precondition:
+*	An integer specifying the # threads batches run on, the calling
+*	thread included (zero or less for one per hardware thread).
+*
+* Postcondition:
+*	numThreads - 1 worker threads are waiting for a batch.
+**********************************************************************/
+ThreadPool::ThreadPool(int numThreads) : m_workers(nullptr), m_numWorkers(0),
+m_task(nullptr), m_numTasks(0), m_nextTask(0), m_running(false), m_numBusy(0), m_batch(0), m_stopping(false)
+{
+	if (numThreads <= 0)
+		numThreads = static_cast<int>(std::thread::hardware_concurrency());
+
+	//The calling thread is one of the threads
+	if (numThreads > 1)
+	{
+		m_numWorkers = numThreads - 1;
+		m_workers = new std::thread[m_numWorkers];
+
+		for (int i = 0; i < m_numWorkers; i++)
+			m_workers[i] = std::thread(&ThreadPool::WorkerLoop, this);
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To stop the worker threads and destroy the pool.
+*
+* Precondition:
+*	No batch is running.
+*
+* Postcondition:
+*	Every worker thread has exited and been joined.
+**********************************************************************/
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+
+	m_wake.notify_all();
+
+	for (int i = 0; i < m_numWorkers; i++)
+		m_workers[i].join();
+
+	delete[] m_workers;
+	m_workers = nullptr;
+	m_numWorkers = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the # threads a batch runs on.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The # worker threads plus one for the caller is returned.
+**********************************************************************/
+int ThreadPool::GetThreadCount() const
+{
+	return m_numWorkers + 1;
+}
+
+/**********************************************************************
+* Purpose:
+*	To run a batch of numbered tasks on the workers and the calling
+*	thread. Tasks are handed out one at a time from a shared counter,
+*	so threads that finish early take more of them.
+*
+*	The workers serve one batch at a time; a batch that finds them
+*	taken by another runs on the calling thread instead of waiting.
+*
+* Precondition:
+*	An integer specifying the # tasks, and the task to run for each
+*	number.
+*
+* Postcondition:
+*	task(i) has returned for every i in [0, numTasks).
+**********************************************************************/
+void ThreadPool::Run(int numTasks, const std::function<void(int)> & task)
+{
+	//W/o workers to share w/, or while another batch holds them, run
+	//the batch right here
+	if (m_numWorkers == 0 || numTasks <= 1 || m_running.exchange(true))
+	{
+		for (int i = 0; i < numTasks; i++)
+			task(i);
+
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_task = &task;
+		m_numTasks = numTasks;
+		m_nextTask = 0;
+		m_numBusy = m_numWorkers;
+		m_batch++;
+	}
+
+	m_wake.notify_all();
+
+	//Help out, then wait for workers still on their last task
+	RunTasks();
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [this] { return m_numBusy == 0; });
+	m_task = nullptr;
+
+	//Hand the workers to the next batch
+	m_running = false;
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the pool shared by code that isn't given one.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	A pointer to a pool w/one thread per hardware thread that lives
+*	until the program exits is returned.
+**********************************************************************/
+ThreadPool * ThreadPool::GetDefault()
+{
+	static ThreadPool pool;
+
+	return &pool;
+}
+
+/**********************************************************************
+* Purpose:
+*	To wait for each batch, run its tasks, and report back, until
+*	the pool is destroyed.
+*
+* Precondition:
+*	Run on a worker thread.
+*
+* Postcondition:
+*	The pool is stopping.
+**********************************************************************/
+void ThreadPool::WorkerLoop()
+{
+	unsigned int batch = 0;		//Latest batch this worker has run
+
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wake.wait(lock, [this, batch] { return m_stopping || m_batch != batch; });
+
+			if (m_stopping)
+				return;
+
+			batch = m_batch;
+		}
+
+		RunTasks();
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			//If this is the last worker on the batch, let Run() return
+			if (--m_numBusy == 0)
+				m_done.notify_one();
+		}
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To take tasks of the current batch and run them until every task
+*	has been taken.
+*
+* Precondition:
+*	A batch is running.
+*
+* Postcondition:
+*	Every task of the batch has been taken by some thread.
+**********************************************************************/
+void ThreadPool::RunTasks()
+{
+	for (int i = m_nextTask++; i < m_numTasks; i = m_nextTask++)
+		(*m_task)(i);
+}
@@ -0,0 +1,93 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			threadpool.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: ThreadPool
+*
+* Purpose:
+*	This class keeps a set of worker threads waiting to split a batch
+*	of numbered tasks w/the calling thread, e.g. the tiles of a board
+*	being generated. The threads are made once, so a batch costs a
+*	wake-up, not a thread start per task.
+*
+* Manager functions:
+*	explicit ThreadPool(int numThreads = 0)
+*		Creates a pool whose batches run on numThreads threads, the
+*		calling thread included (one per hardware thread by default).
+*
+*	~ThreadPool()
+*		Stops and joins the worker threads.
+*
+*	A pool owns its threads, so it cannot be copied.
+*
+* Methods:
+*	int GetThreadCount() const
+*		Returns the # threads a batch runs on, the caller included.
+*
+*	void Run(int numTasks, const std::function<void(int)> & task)
+*		Runs task(i) for every i in [0, numTasks), in no set order and
+*		on any of the threads, and returns when all are done. Tasks
+*		must not throw. Any thread may call it; a batch started while
+*		another is running (e.g. two boards built on two threads at
+*		once, or a task starting a batch) runs on its caller alone.
+*
+*	static ThreadPool * GetDefault()
+*		Returns a pool w/one thread per hardware thread that lives
+*		until the program exits.
+**********************************************************************/
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+class ThreadPool
+{
+public:
+	//1-arg Ctor
+	explicit ThreadPool(int numThreads = 0);
+
+	//Default Dtor
+	~ThreadPool();
+
+	//# threads a batch runs on
+	int GetThreadCount() const;
+
+	//Run a batch of numbered tasks
+	void Run(int numTasks, const std::function<void(int)> & task);
+
+	//Pool w/one thread per hardware thread
+	static ThreadPool * GetDefault();
+
+private:
+	//Pools own their threads, so they cannot be copied
+	ThreadPool(const ThreadPool & copy);
+	ThreadPool & operator=(const ThreadPool & rhs);
+
+	//Wait for batches & help run them
+	void WorkerLoop();
+
+	//Run tasks of the current batch until none are left
+	void RunTasks();
+
+	std::thread * m_workers;	//Threads besides the caller
+	int m_numWorkers;			//# worker threads
+	std::mutex m_mutex;			//Guards everything below but m_nextTask & m_running
+	std::condition_variable m_wake;	//Signals a new batch or stopping
+	std::condition_variable m_done;	//Signals the last worker finishing
+	const std::function<void(int)> * m_task;	//Task of the current batch
+	int m_numTasks;				//# tasks in the current batch
+	std::atomic<int> m_nextTask;	//Next task to hand out
+	std::atomic<bool> m_running;	//Whether a batch holds the workers
+	int m_numBusy;				//# workers still on the current batch
+	unsigned int m_batch;		//# batches started
+	bool m_stopping;			//Whether workers should exit
+};
+
+#endif //THREADPOOL_H
@@ -0,0 +1,28 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			zerodefault.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Trait: IsZeroDefault
+*
+* Purpose:
+*	Tells the containers which types have a default value that is all
+*	zero bytes, so their storage can come straight from calloc (or any
+*	other zeroed memory) w/o constructing each element. Scalars are
+*	zero default; a value type where this holds specializes the trait
+*	next to its own definition, w/o depending on the containers.
+**********************************************************************/
+
+#ifndef ZERODEFAULT_H
+#define ZERODEFAULT_H
+
+#include <type_traits>
+
+//Types whose default value is all zero bytes. Specialize for other types
+//where this holds.
+template <typename T>
+struct IsZeroDefault : std::integral_constant<bool, std::is_scalar<T>::value>
+{};
+
+#endif //ZERODEFAULT_H